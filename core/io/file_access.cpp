@@ -533,6 +533,31 @@ String FileAccess::get_as_text(bool p_skip_cr) const {
 	return text;
 }
 
+FileAccess::AsyncReadID FileAccess::read_async(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) {
+	ERR_FAIL_COND_V(!p_dst && p_length > 0, INVALID_ASYNC_READ_ID);
+
+	uint64_t position = get_position();
+	seek(p_offset);
+	int64_t read = get_buffer(p_dst, p_length);
+	seek(position);
+
+	AsyncReadID id = ++last_async_read_id;
+	async_read_results[id] = read;
+	return id;
+}
+
+bool FileAccess::is_async_read_completed(AsyncReadID p_id) const {
+	return async_read_results.has(p_id);
+}
+
+int64_t FileAccess::wait_for_async_read(AsyncReadID p_id) {
+	HashMap<AsyncReadID, int64_t>::Iterator E = async_read_results.find(p_id);
+	ERR_FAIL_COND_V_MSG(!E, -1, "Invalid or already waited for asynchronous read.");
+	int64_t read = E->value;
+	async_read_results.remove(E);
+	return read;
+}
+
 Vector<uint8_t> FileAccess::get_buffer(int64_t p_length) const {
 	Vector<uint8_t> data;
 
@@ -776,14 +801,14 @@ bool FileAccess::store_buffer(const uint8_t *p_src, uint64_t p_length) {
 
 bool FileAccess::store_var(const Variant &p_var, bool p_full_objects) {
 	int len;
-	Error err = encode_variant(p_var, nullptr, len, p_full_objects);
+	Error err = compact_var_encoding ? encode_variant_compact(p_var, nullptr, len, p_full_objects) : encode_variant(p_var, nullptr, len, p_full_objects);
 	ERR_FAIL_COND_V_MSG(err != OK, false, "Error when trying to encode Variant.");
 
 	Vector<uint8_t> buff;
 	buff.resize(len);
 
 	uint8_t *w = buff.ptrw();
-	err = encode_variant(p_var, &w[0], len, p_full_objects);
+	err = compact_var_encoding ? encode_variant_compact(p_var, &w[0], len, p_full_objects) : encode_variant(p_var, &w[0], len, p_full_objects);
 	ERR_FAIL_COND_V_MSG(err != OK, false, "Error when trying to encode Variant.");
 
 	return store_32(uint32_t(len)) && store_buffer(buff);
@@ -955,6 +980,8 @@ void FileAccess::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("store_csv_line", "values", "delim"), &FileAccess::store_csv_line, DEFVAL(","));
 	ClassDB::bind_method(D_METHOD("store_string", "string"), &FileAccess::store_string);
 	ClassDB::bind_method(D_METHOD("store_var", "value", "full_objects"), &FileAccess::store_var, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("set_compact_var_encoding", "enabled"), &FileAccess::set_compact_var_encoding);
+	ClassDB::bind_method(D_METHOD("is_compact_var_encoding_enabled"), &FileAccess::is_compact_var_encoding_enabled);
 
 	ClassDB::bind_method(D_METHOD("store_pascal_string", "string"), &FileAccess::store_pascal_string);
 	ClassDB::bind_method(D_METHOD("get_pascal_string"), &FileAccess::get_pascal_string);
@@ -973,6 +1000,7 @@ void FileAccess::_bind_methods() {
 	ClassDB::bind_static_method("FileAccess", D_METHOD("get_read_only_attribute", "file"), &FileAccess::get_read_only_attribute);
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "big_endian"), "set_big_endian", "is_big_endian");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "compact_var_encoding"), "set_compact_var_encoding", "is_compact_var_encoding_enabled");
 
 	BIND_ENUM_CONSTANT(READ);
 	BIND_ENUM_CONSTANT(WRITE);
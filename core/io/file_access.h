@@ -87,8 +87,12 @@ public:
 	typedef void (*FileCloseFailNotify)(const String &);
 
 	typedef Ref<FileAccess> (*CreateFunc)();
+	typedef int64_t AsyncReadID;
+	static constexpr AsyncReadID INVALID_ASYNC_READ_ID = -1;
+
 	bool big_endian = false;
 	bool real_is_double = false;
+	bool compact_var_encoding = false;
 
 	virtual BitField<UnixPermissionFlags> _get_unix_permissions(const String &p_file) = 0;
 	virtual Error _set_unix_permissions(const String &p_file, BitField<UnixPermissionFlags> p_permissions) = 0;
@@ -109,6 +113,10 @@ protected:
 
 	static FileCloseFailNotify close_fail_notify;
 
+	// Results of the reads started with the default read_async(), which reads right away.
+	HashMap<AsyncReadID, int64_t> async_read_results;
+	AsyncReadID last_async_read_id = 0;
+
 #ifndef DISABLE_DEPRECATED
 	static Ref<FileAccess> _open_encrypted_bind_compat_98918(const String &p_path, ModeFlags p_mode_flags, const Vector<uint8_t> &p_key);
 
@@ -178,6 +186,18 @@ public:
 	Variant get_var(bool p_allow_objects = false) const;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const = 0; ///< get an array of bytes, needs to be overwritten by children.
+
+	// Maps a part of the file in memory, to read it without copies. Returns nullptr if the file can't be mapped,
+	// in which case get_buffer() must be used. The view stays valid until the file is closed or mapped again.
+	virtual const uint8_t *map_buffer(uint64_t p_offset, uint64_t p_length) { return nullptr; }
+
+	// Starts reading a part of the file into p_dst, without moving the cursor. p_dst must stay valid, and the file open,
+	// until the read is waited for. Platforms can read in the background, otherwise the data is read before returning.
+	virtual AsyncReadID read_async(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length);
+	virtual bool is_async_read_completed(AsyncReadID p_id) const;
+	// Returns the number of bytes read, or -1 if the read failed. Every read must be waited for once.
+	virtual int64_t wait_for_async_read(AsyncReadID p_id);
+
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
 	virtual String get_line() const;
 	virtual String get_token() const;
@@ -220,6 +240,9 @@ public:
 
 	bool store_var(const Variant &p_var, bool p_full_objects = false);
 
+	void set_compact_var_encoding(bool p_enabled) { compact_var_encoding = p_enabled; }
+	bool is_compact_var_encoding_enabled() const { return compact_var_encoding; }
+
 	virtual void close() = 0;
 
 	virtual bool file_exists(const String &p_name) = 0; ///< return true if a file exists
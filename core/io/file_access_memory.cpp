@@ -141,6 +141,13 @@ uint64_t FileAccessMemory::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+const uint8_t *FileAccessMemory::map_buffer(uint64_t p_offset, uint64_t p_length) {
+	ERR_FAIL_NULL_V(data, nullptr);
+	ERR_FAIL_COND_V(p_offset + p_length > length, nullptr);
+
+	return &data[p_offset];
+}
+
 Error FileAccessMemory::get_error() const {
 	return pos >= length ? ERR_FILE_EOF : OK;
 }
@@ -30,8 +30,11 @@
 
 #include "file_access_pack.h"
 
+#include "core/io/compression.h"
 #include "core/io/file_access_encrypted.h"
+#include "core/io/marshalls.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/version.h"
 
@@ -45,7 +48,7 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t
 	return ERR_FILE_UNRECOGNIZED;
 }
 
-void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted) {
+void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_compressed) {
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
 
@@ -53,6 +56,7 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 
 	PackedFile pf;
 	pf.encrypted = p_encrypted;
+	pf.compressed = p_compressed;
 	pf.pack = p_pkg_path;
 	pf.offset = p_ofs;
 	pf.size = p_size;
@@ -156,6 +160,32 @@ void PackedData::clear() {
 	files.clear();
 	_free_packed_dirs(root);
 	root = memnew(PackedDir);
+
+	// Files that are still open keep their mapping alive.
+	MutexLock lock(pack_mappings_mutex);
+	pack_mappings.clear();
+}
+
+PackedData::PackMapping PackedData::_get_pack_mapping(const String &p_pack) {
+	MutexLock lock(pack_mappings_mutex);
+	HashMap<String, PackMapping>::ConstIterator E = pack_mappings.find(p_pack);
+	if (E) {
+		return E->value;
+	}
+
+	// Packs that can't be mapped are remembered as well, so mapping them is only tried once.
+	PackMapping mapping;
+	Ref<FileAccess> f = FileAccess::open(p_pack, FileAccess::READ);
+	if (f.is_valid()) {
+		const uint64_t length = f->get_length();
+		mapping.data = f->map_buffer(0, length);
+		if (mapping.data) {
+			mapping.file = f;
+			mapping.length = length;
+		}
+	}
+	pack_mappings.insert(p_pack, mapping);
+	return mapping;
 }
 
 PackedData *PackedData::singleton = nullptr;
@@ -263,7 +293,7 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 	uint32_t ver_minor = f->get_32();
 	f->get_32(); // patch number, not used for validation.
 
-	ERR_FAIL_COND_V_MSG(version != PACK_FORMAT_VERSION, false, vformat("Pack version unsupported: %d.", version));
+	ERR_FAIL_COND_V_MSG(version < PACK_FORMAT_VERSION_MIN || version > PACK_FORMAT_VERSION, false, vformat("Pack version unsupported: %d.", version));
 	ERR_FAIL_COND_V_MSG(ver_major > VERSION_MAJOR || (ver_major == VERSION_MAJOR && ver_minor > VERSION_MINOR), false, vformat("Pack created with a newer version of the engine: %d.%d.", ver_major, ver_minor));
 
 	uint32_t pack_flags = f->get_32();
@@ -318,7 +348,7 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		if (flags & PACK_FILE_REMOVAL) { // The file was removed.
 			PackedData::get_singleton()->remove_path(path);
 		} else {
-			PackedData::get_singleton()->add_path(p_path, path, file_base + ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED));
+			PackedData::get_singleton()->add_path(p_path, path, file_base + ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), (flags & PACK_FILE_COMPRESSED));
 		}
 	}
 
@@ -391,7 +421,9 @@ void FileAccessPack::seek(uint64_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (!mapped) {
+		f->seek(off + p_position);
+	}
 	pos = p_position;
 }
 
@@ -425,16 +457,47 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 		to_read = (int64_t)pf.size - (int64_t)pos;
 	}
 
-	pos += to_read;
-
 	if (to_read <= 0) {
 		return 0;
 	}
-	f->get_buffer(p_dst, to_read);
+
+	if (mapped) {
+		memcpy(p_dst, mapped + pos, to_read);
+	} else {
+		f->get_buffer(p_dst, to_read);
+	}
+	pos += to_read;
 
 	return to_read;
 }
 
+const uint8_t *FileAccessPack::map_buffer(uint64_t p_offset, uint64_t p_length) {
+	ERR_FAIL_COND_V_MSG(f.is_null(), nullptr, "File must be opened before use.");
+	ERR_FAIL_COND_V(p_offset + p_length > pf.size, nullptr);
+
+	return mapped ? mapped + p_offset : nullptr;
+}
+
+FileAccess::AsyncReadID FileAccessPack::read_async(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) {
+	ERR_FAIL_COND_V_MSG(f.is_null(), INVALID_ASYNC_READ_ID, "File must be opened before use.");
+	if (mapped) {
+		return FileAccess::read_async(p_offset, p_dst, p_length); // Copied right away.
+	}
+
+	uint64_t length = p_offset < pf.size ? MIN(p_length, pf.size - p_offset) : 0;
+	return f->read_async(off + p_offset, p_dst, length);
+}
+
+bool FileAccessPack::is_async_read_completed(AsyncReadID p_id) const {
+	ERR_FAIL_COND_V_MSG(f.is_null(), false, "File must be opened before use.");
+	return mapped ? FileAccess::is_async_read_completed(p_id) : f->is_async_read_completed(p_id);
+}
+
+int64_t FileAccessPack::wait_for_async_read(AsyncReadID p_id) {
+	ERR_FAIL_COND_V_MSG(f.is_null(), -1, "File must be opened before use.");
+	return mapped ? FileAccess::wait_for_async_read(p_id) : f->wait_for_async_read(p_id);
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
 	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
 
@@ -461,7 +524,115 @@ bool FileAccessPack::file_exists(const String &p_name) {
 	return false;
 }
 
+struct PackBlockDecompression {
+	const uint8_t *src = nullptr;
+	uint8_t *dst = nullptr;
+	uint32_t block_size = 0;
+	uint64_t length = 0;
+	LocalVector<uint64_t> offsets; // Offset of each block in the source, followed by the end of the last block.
+	SafeFlag failed;
+
+	static void decompress_block(void *p_userdata, uint32_t p_index) {
+		PackBlockDecompression *job = (PackBlockDecompression *)p_userdata;
+		uint64_t dst_ofs = (uint64_t)p_index * job->block_size;
+		int dst_size = MIN((uint64_t)job->block_size, job->length - dst_ofs);
+		int src_size = job->offsets[p_index + 1] - job->offsets[p_index];
+
+		int ret = Compression::decompress(job->dst + dst_ofs, dst_size, job->src + job->offsets[p_index], src_size, Compression::MODE_ZSTD);
+		if (ret != dst_size) {
+			job->failed.set();
+		}
+	}
+};
+
+Error FileAccessPack::_decompress() {
+	// Blocks are independent, so the whole file is decompressed at once, in parallel when possible.
+	ERR_FAIL_COND_V(pf.size < 16, ERR_FILE_CORRUPT);
+	Vector<uint8_t> stored;
+	const uint8_t *src = mapped;
+	if (!src) {
+		// Only the header and block table are read here, the blocks are read in the background below.
+		ERR_FAIL_COND_V(f->get_position() > f->get_length() || pf.size > f->get_length() - f->get_position(), ERR_FILE_CORRUPT);
+		stored.resize(pf.size);
+		ERR_FAIL_COND_V(f->get_buffer(stored.ptrw(), 16) != 16, ERR_FILE_CORRUPT);
+		uint64_t table_size = (uint64_t)decode_uint32(stored.ptr() + 4) * 4;
+		ERR_FAIL_COND_V(table_size > pf.size - 16, ERR_FILE_CORRUPT);
+		ERR_FAIL_COND_V(f->get_buffer(stored.ptrw() + 16, table_size) != table_size, ERR_FILE_CORRUPT);
+		src = stored.ptr();
+	}
+
+	uint32_t block_size = decode_uint32(src);
+	uint32_t block_count = decode_uint32(src + 4);
+	uint64_t length = decode_uint64(src + 8);
+	ERR_FAIL_COND_V(block_size == 0 || block_size > PACK_COMPRESSED_BLOCK_SIZE, ERR_FILE_CORRUPT);
+	// Every block takes at least one byte besides its size, and all of them but the last one are full.
+	ERR_FAIL_COND_V(block_count > (pf.size - 16) / 5, ERR_FILE_CORRUPT);
+	ERR_FAIL_COND_V(length > (uint64_t)block_count * block_size || (block_count > 0 && length <= (uint64_t)(block_count - 1) * block_size), ERR_FILE_CORRUPT);
+
+	uint64_t block_ofs = 16 + (uint64_t)block_count * 4;
+
+	PackBlockDecompression job;
+	job.offsets.resize(block_count + 1);
+	for (uint32_t i = 0; i < block_count; i++) {
+		uint32_t src_size = decode_uint32(src + 16 + i * 4);
+		ERR_FAIL_COND_V(src_size == 0 || src_size > pf.size - block_ofs, ERR_FILE_CORRUPT);
+		job.offsets[i] = block_ofs;
+		block_ofs += src_size;
+	}
+	job.offsets[block_count] = block_ofs;
+
+	decompressed.resize(length);
+	job.src = src;
+	job.dst = decompressed.ptrw();
+	job.block_size = block_size;
+	job.length = length;
+
+	// Start reading all blocks, so that each one can be decompressed as soon as it arrives. Every read must be
+	// waited for, even after a failure, as they write to the stored buffer.
+	LocalVector<AsyncReadID> block_reads;
+	if (!mapped) {
+		block_reads.resize(block_count);
+		uint8_t *stored_w = stored.ptrw();
+		for (uint32_t i = 0; i < block_count; i++) {
+			block_reads[i] = f->read_async(off + job.offsets[i], stored_w + job.offsets[i], job.offsets[i + 1] - job.offsets[i]);
+		}
+	}
+	bool read_failed = false;
+
+	// Waiting for a group from a pool thread could starve the pool, so loading tasks decompress in place.
+	WorkerThreadPool *wtp = WorkerThreadPool::get_singleton();
+	if (block_count > 1 && wtp->get_thread_count() > 0 && WorkerThreadPool::get_thread_index() == -1) {
+		for (uint32_t i = 0; i < block_reads.size(); i++) {
+			if (f->wait_for_async_read(block_reads[i]) != int64_t(job.offsets[i + 1] - job.offsets[i])) {
+				read_failed = true;
+			}
+		}
+		if (!read_failed) {
+			WorkerThreadPool::GroupID group_id = wtp->add_native_group_task(&PackBlockDecompression::decompress_block, &job, block_count, -1, true, String("DecompressPackFile"));
+			wtp->wait_for_group_task_completion(group_id);
+		}
+	} else {
+		for (uint32_t i = 0; i < block_count; i++) {
+			if (!block_reads.is_empty() && f->wait_for_async_read(block_reads[i]) != int64_t(job.offsets[i + 1] - job.offsets[i])) {
+				read_failed = true;
+			}
+			if (!read_failed) {
+				PackBlockDecompression::decompress_block(&job, i);
+			}
+		}
+	}
+	ERR_FAIL_COND_V(read_failed || job.failed.is_set(), ERR_FILE_CORRUPT);
+
+	mapped = decompressed.ptr();
+	pack_mapping = Ref<FileAccess>();
+	pf.size = length;
+	return OK;
+}
+
 void FileAccessPack::close() {
+	mapped = nullptr;
+	pack_mapping = Ref<FileAccess>();
+	decompressed.clear();
 	f = Ref<FileAccess>();
 }
 
@@ -488,6 +659,20 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		ERR_FAIL_COND_MSG(err, vformat("Can't open encrypted pack-referenced file '%s'.", String(pf.pack)));
 		f = fae;
 		off = 0;
+	} else if (pf.size > 0) {
+		// Reads are served from memory when the pack can be mapped, and resource loaders can access the contents without copies.
+		PackedData::PackMapping mapping = PackedData::get_singleton()->_get_pack_mapping(pf.pack);
+		if (mapping.data && off + pf.size <= mapping.length) {
+			pack_mapping = mapping.file;
+			mapped = mapping.data + off;
+		}
+	}
+
+	if (pf.compressed && _decompress() != OK) {
+		mapped = nullptr;
+		pack_mapping = Ref<FileAccess>();
+		f = Ref<FileAccess>();
+		ERR_FAIL_MSG(vformat("Can't decompress pack-referenced file '%s'.", String(pf.pack)));
 	}
 	pos = 0;
 	eof = false;
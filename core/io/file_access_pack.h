@@ -33,6 +33,7 @@
 
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/os/mutex.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
@@ -40,7 +41,11 @@
 // Godot's packed file magic header ("GDPC" in ASCII).
 #define PACK_HEADER_MAGIC 0x43504447
 // The current packed file format version number.
-#define PACK_FORMAT_VERSION 2
+#define PACK_FORMAT_VERSION 3
+// The oldest packed file format version that can still be read, and the one written when no file is compressed.
+#define PACK_FORMAT_VERSION_MIN 2
+// Size of the blocks of compressed files, each block is compressed separately.
+#define PACK_COMPRESSED_BLOCK_SIZE (64 * 1024)
 
 enum PackFlags {
 	PACK_DIR_ENCRYPTED = 1 << 0,
@@ -50,8 +55,16 @@ enum PackFlags {
 enum PackFileFlags {
 	PACK_FILE_ENCRYPTED = 1 << 0,
 	PACK_FILE_REMOVAL = 1 << 1,
+	PACK_FILE_COMPRESSED = 1 << 2, // Since format version 3.
 };
 
+// Compressed files are stored as:
+//  uint32 block size
+//  uint32 block count
+//  uint64 uncompressed length
+//  uint32 compressed size of each block
+//  the blocks, compressed with Zstandard
+
 class PackSource;
 
 class PackedData {
@@ -67,6 +80,7 @@ public:
 		uint8_t md5[16];
 		PackSource *src = nullptr;
 		bool encrypted;
+		bool compressed = false;
 	};
 
 private:
@@ -103,15 +117,26 @@ private:
 
 	PackedDir *root = nullptr;
 
+	// Packs are mapped in memory once, and the mapping is shared by all the files opened from them.
+	struct PackMapping {
+		Ref<FileAccess> file; // Keeps the mapping alive, null if the pack can't be mapped.
+		const uint8_t *data = nullptr;
+		uint64_t length = 0;
+	};
+
+	HashMap<String, PackMapping> pack_mappings;
+	Mutex pack_mappings_mutex;
+
 	static PackedData *singleton;
 	bool disabled = false;
 
+	PackMapping _get_pack_mapping(const String &p_pack);
 	void _free_packed_dirs(PackedDir *p_dir);
 	void _get_file_paths(PackedDir *p_dir, const String &p_parent_dir, HashSet<String> &r_paths) const;
 
 public:
 	void add_pack_source(PackSource *p_source);
-	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false); // for PackSource
+	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_compressed = false); // for PackSource
 	void remove_path(const String &p_path);
 	uint8_t *get_file_hash(const String &p_path);
 	HashSet<String> get_file_paths() const;
@@ -163,6 +188,12 @@ class FileAccessPack : public FileAccess {
 	uint64_t off;
 
 	Ref<FileAccess> f;
+	const uint8_t *mapped = nullptr; // Contents of the file if the pack could be mapped in memory.
+	Ref<FileAccess> pack_mapping; // Owner of the shared mapping of the pack.
+	Vector<uint8_t> decompressed; // Contents of compressed files.
+
+	Error _decompress();
+
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override;
 	virtual uint64_t _get_modified_time(const String &p_file) override { return 0; }
 	virtual BitField<FileAccess::UnixPermissionFlags> _get_unix_permissions(const String &p_file) override { return 0; }
@@ -184,6 +215,11 @@ public:
 	virtual bool eof_reached() const override;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *map_buffer(uint64_t p_offset, uint64_t p_length) override;
+
+	virtual AsyncReadID read_async(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) override;
+	virtual bool is_async_read_completed(AsyncReadID p_id) const override;
+	virtual int64_t wait_for_async_read(AsyncReadID p_id) override;
 
 	virtual void set_big_endian(bool p_big_endian) override;
 
@@ -35,6 +35,7 @@
 #include "core/object/script_language.h"
 #include "core/variant/container_type_validate.h"
 
+#include <cmath>
 #include <limits.h>
 #include <stdio.h>
 
@@ -88,6 +89,40 @@ enum ContainerTypeKind {
 #define GET_CONTAINER_TYPE_KIND(m_header, m_field) \
 	((ContainerTypeKind)(((m_header) & HEADER_DATA_FIELD_##m_field##_MASK) >> HEADER_DATA_FIELD_##m_field##_SHIFT))
 
+// Compact encoding.
+//
+// The stream starts with `COMPACT_ENCODING_MARKER`, which is never a valid first byte of the regular
+// encoding, so `decode_variant()` can tell both apart. Every value then starts with a tag byte holding
+// the `Variant::Type` and up to two flags. Lengths, counts and integers are stored as LEB128 varints
+// (signed integers are zigzag encoded), nothing is padded, and each distinct non-empty string is only
+// stored once: later occurrences refer to it by index.
+
+#define COMPACT_ENCODING_MARKER 0xC0
+
+// Bits 0 to 5: `Variant::Type`, bits 6 and 7: flags.
+#define COMPACT_TAG_TYPE_MASK 0x3F
+
+// For `Variant::BOOL`.
+#define COMPACT_TAG_FLAG_TRUE (1 << 6)
+
+// For `Variant::FLOAT` and other math types.
+#define COMPACT_TAG_FLAG_64 (1 << 6)
+
+// For `Variant::FLOAT`, the value is integral and stored as a varint.
+#define COMPACT_TAG_FLAG_INTEGRAL (1 << 7)
+
+// For `Variant::NODE_PATH`.
+#define COMPACT_TAG_FLAG_ABSOLUTE (1 << 6)
+
+// For `Variant::OBJECT`.
+#define COMPACT_TAG_FLAG_OBJECT_AS_ID (1 << 6)
+
+// For `Variant::ARRAY` and `Variant::DICTIONARY`, followed by a byte with the container type kinds.
+#define COMPACT_TAG_FLAG_TYPED (1 << 6)
+
+static_assert(Variant::VARIANT_MAX <= COMPACT_TAG_TYPE_MASK, "Variant::Type doesn't fit in the compact encoding tag.");
+static_assert(Variant::VARIANT_MAX <= COMPACT_ENCODING_MARKER, "The compact encoding marker must not be a valid Variant::Type.");
+
 static Error _decode_string(const uint8_t *&buf, int &len, int *r_len, String &r_string) {
 	ERR_FAIL_COND_V(len < 4, ERR_INVALID_DATA);
 
@@ -182,8 +217,28 @@ static Error _decode_container_type(const uint8_t *&buf, int &len, int *r_len, b
 	ERR_FAIL_V_MSG(ERR_INVALID_DATA, "Invalid container type kind."); // Future proofing.
 }
 
+static Error _set_decoded_object_property(Object *p_object, const String &p_name, const Variant &p_value) {
+	if (p_name == "script" && p_value.get_type() != Variant::NIL) {
+		ERR_FAIL_COND_V_MSG(p_value.get_type() != Variant::STRING, ERR_INVALID_DATA, "Invalid value for \"script\" property, expected script path as String.");
+		String path = p_value;
+		ERR_FAIL_COND_V_MSG(path.is_empty() || !path.begins_with("res://") || !ResourceLoader::exists(path, "Script"), ERR_INVALID_DATA, vformat("Invalid script path \"%s\".", path));
+		Ref<Script> script = ResourceLoader::load(path, "Script");
+		ERR_FAIL_COND_V_MSG(script.is_null(), ERR_INVALID_DATA, vformat("Can't load script at path \"%s\".", path));
+		p_object->set_script(script);
+	} else {
+		p_object->set(p_name, p_value);
+	}
+	return OK;
+}
+
+static Error _decode_variant_compact(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len, bool p_allow_objects);
+
 Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len, bool p_allow_objects, int p_depth) {
 	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Variant is too deep. Bailing.");
+	if (p_depth == 0 && p_len > 0 && p_buffer[0] == COMPACT_ENCODING_MARKER) {
+		return _decode_variant_compact(r_variant, p_buffer, p_len, r_len, p_allow_objects);
+	}
+
 	const uint8_t *buf = p_buffer;
 	int len = p_len;
 
@@ -768,15 +823,9 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 							(*r_len) += used;
 						}
 
-						if (str == "script" && value.get_type() != Variant::NIL) {
-							ERR_FAIL_COND_V_MSG(value.get_type() != Variant::STRING, ERR_INVALID_DATA, "Invalid value for \"script\" property, expected script path as String.");
-							String path = value;
-							ERR_FAIL_COND_V_MSG(path.is_empty() || !path.begins_with("res://") || !ResourceLoader::exists(path, "Script"), ERR_INVALID_DATA, vformat("Invalid script path \"%s\".", path));
-							Ref<Script> script = ResourceLoader::load(path, "Script");
-							ERR_FAIL_COND_V_MSG(script.is_null(), ERR_INVALID_DATA, vformat("Can't load script at path \"%s\".", path));
-							obj->set_script(script);
-						} else {
-							obj->set(str, value);
+						err = _set_decoded_object_property(obj, str, value);
+						if (err) {
+							return err;
 						}
 					}
 
@@ -2135,6 +2184,1118 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 	return OK;
 }
 
+class CompactVariantEncoder {
+	uint8_t *buf = nullptr;
+	int len = 0;
+	bool full_objects = false;
+	HashMap<String, uint32_t> strings;
+
+	void put_varint(uint64_t p_value) {
+		while (p_value >= 0x80) {
+			put_u8(uint8_t(p_value) | 0x80);
+			p_value >>= 7;
+		}
+		put_u8(uint8_t(p_value));
+	}
+
+	void put_int(int64_t p_value) {
+		put_varint((uint64_t(p_value) << 1) ^ uint64_t(p_value >> 63));
+	}
+
+	void put_float(float p_value) {
+		if (buf) {
+			encode_float(p_value, &buf[len]);
+		}
+		len += 4;
+	}
+
+	void put_double(double p_value) {
+		if (buf) {
+			encode_double(p_value, &buf[len]);
+		}
+		len += 8;
+	}
+
+	void put_reals(const real_t *p_reals, int p_count) {
+		for (int i = 0; i < p_count; i++) {
+#ifdef REAL_T_IS_DOUBLE
+			put_double(p_reals[i]);
+#else
+			put_float(p_reals[i]);
+#endif
+		}
+	}
+
+	void put_data(const uint8_t *p_data, int p_size) {
+		if (buf && p_size > 0) {
+			memcpy(&buf[len], p_data, p_size);
+		}
+		len += p_size;
+	}
+
+	void put_string(const String &p_string) {
+		// Low bit set: index of a previously stored string, unset: length of a new one.
+		if (p_string.is_empty()) {
+			put_varint(0);
+			return;
+		}
+
+		const uint32_t *index = strings.getptr(p_string);
+		if (index) {
+			put_varint((uint64_t(*index) << 1) | 1);
+			return;
+		}
+		strings.insert(p_string, strings.size());
+
+		CharString utf8 = p_string.utf8();
+		put_varint(uint64_t(utf8.length()) << 1);
+		put_data((const uint8_t *)utf8.get_data(), utf8.length());
+	}
+
+	template <typename T>
+	void put_math(const Variant &p_variant) {
+		static_assert(sizeof(T) % sizeof(real_t) == 0);
+		const T value = p_variant;
+#ifdef REAL_T_IS_DOUBLE
+		put_u8(p_variant.get_type() | COMPACT_TAG_FLAG_64);
+#else
+		put_u8(p_variant.get_type());
+#endif
+		put_reals(reinterpret_cast<const real_t *>(&value), sizeof(T) / sizeof(real_t));
+	}
+
+	template <typename T>
+	void put_math_int(const Variant &p_variant) {
+		static_assert(sizeof(T) % sizeof(int32_t) == 0);
+		const T value = p_variant;
+		const int32_t *coords = reinterpret_cast<const int32_t *>(&value);
+		put_u8(p_variant.get_type());
+		for (size_t i = 0; i < sizeof(T) / sizeof(int32_t); i++) {
+			put_int(coords[i]);
+		}
+	}
+
+	template <typename T>
+	void put_packed_vector(const Variant &p_variant) {
+		static_assert(sizeof(T) % sizeof(real_t) == 0);
+		const Vector<T> data = p_variant;
+#ifdef REAL_T_IS_DOUBLE
+		put_u8(p_variant.get_type() | COMPACT_TAG_FLAG_64);
+#else
+		put_u8(p_variant.get_type());
+#endif
+		put_varint(data.size());
+		put_reals(reinterpret_cast<const real_t *>(data.ptr()), data.size() * (sizeof(T) / sizeof(real_t)));
+	}
+
+	Error put_container_type(const ContainerType &p_type) {
+		if (p_type.builtin_type == Variant::NIL) {
+			return OK;
+		}
+
+		if (p_type.script.is_valid()) {
+			if (full_objects) {
+				String path = p_type.script->get_path();
+				ERR_FAIL_COND_V_MSG(path.is_empty() || !path.begins_with("res://"), ERR_UNAVAILABLE, "Failed to encode a path to a custom script for a container type.");
+				put_string(path);
+			} else {
+				put_string(EncodedObjectAsID::get_class_static());
+			}
+		} else if (p_type.class_name != StringName()) {
+			put_string(full_objects ? p_type.class_name.operator String() : EncodedObjectAsID::get_class_static());
+		} else {
+			put_u8(p_type.builtin_type);
+		}
+		return OK;
+	}
+
+public:
+	void put_u8(uint8_t p_value) {
+		if (buf) {
+			buf[len] = p_value;
+		}
+		len++;
+	}
+
+	Error put_variant(const Variant &p_variant, int p_depth) {
+		ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Potential infinite recursion detected. Bailing.");
+
+		switch (p_variant.get_type()) {
+			case Variant::NIL: {
+				put_u8(Variant::NIL);
+			} break;
+			case Variant::BOOL: {
+				put_u8(Variant::BOOL | (p_variant.operator bool() ? COMPACT_TAG_FLAG_TRUE : 0));
+			} break;
+			case Variant::INT: {
+				put_u8(Variant::INT);
+				put_int(p_variant.operator int64_t());
+			} break;
+			case Variant::FLOAT: {
+				double d = p_variant;
+				// Integral values up to 2^53 are exact both as `double` and `int64_t`. Keep `-0.0` as a float.
+				if (d >= -9007199254740992.0 && d <= 9007199254740992.0 && double(int64_t(d)) == d && !(d == 0.0 && std::signbit(d))) {
+					put_u8(Variant::FLOAT | COMPACT_TAG_FLAG_INTEGRAL);
+					put_int(int64_t(d));
+				} else if (double(float(d)) == d) {
+					put_u8(Variant::FLOAT);
+					put_float(d);
+				} else {
+					put_u8(Variant::FLOAT | COMPACT_TAG_FLAG_64);
+					put_double(d);
+				}
+			} break;
+			case Variant::STRING:
+			case Variant::STRING_NAME: {
+				put_u8(p_variant.get_type());
+				put_string(p_variant);
+			} break;
+			case Variant::NODE_PATH: {
+				NodePath np = p_variant;
+				put_u8(Variant::NODE_PATH | (np.is_absolute() ? COMPACT_TAG_FLAG_ABSOLUTE : 0));
+				put_varint(np.get_name_count());
+				put_varint(np.get_subname_count());
+				for (int i = 0; i < np.get_name_count(); i++) {
+					put_string(np.get_name(i));
+				}
+				for (int i = 0; i < np.get_subname_count(); i++) {
+					put_string(np.get_subname(i));
+				}
+			} break;
+
+			// Math types.
+			case Variant::VECTOR2: {
+				put_math<Vector2>(p_variant);
+			} break;
+			case Variant::RECT2: {
+				put_math<Rect2>(p_variant);
+			} break;
+			case Variant::VECTOR3: {
+				put_math<Vector3>(p_variant);
+			} break;
+			case Variant::VECTOR4: {
+				put_math<Vector4>(p_variant);
+			} break;
+			case Variant::TRANSFORM2D: {
+				put_math<Transform2D>(p_variant);
+			} break;
+			case Variant::PLANE: {
+				put_math<Plane>(p_variant);
+			} break;
+			case Variant::QUATERNION: {
+				put_math<Quaternion>(p_variant);
+			} break;
+			case Variant::AABB: {
+				put_math<AABB>(p_variant);
+			} break;
+			case Variant::BASIS: {
+				put_math<Basis>(p_variant);
+			} break;
+			case Variant::TRANSFORM3D: {
+				put_math<Transform3D>(p_variant);
+			} break;
+			case Variant::PROJECTION: {
+				put_math<Projection>(p_variant);
+			} break;
+			case Variant::VECTOR2I: {
+				put_math_int<Vector2i>(p_variant);
+			} break;
+			case Variant::RECT2I: {
+				put_math_int<Rect2i>(p_variant);
+			} break;
+			case Variant::VECTOR3I: {
+				put_math_int<Vector3i>(p_variant);
+			} break;
+			case Variant::VECTOR4I: {
+				put_math_int<Vector4i>(p_variant);
+			} break;
+
+			// Misc types.
+			case Variant::COLOR: {
+				Color c = p_variant;
+				put_u8(Variant::COLOR);
+				put_float(c.r);
+				put_float(c.g);
+				put_float(c.b);
+				put_float(c.a);
+			} break;
+			case Variant::RID: {
+				RID rid = p_variant;
+				put_u8(Variant::RID);
+				put_varint(rid.get_id());
+			} break;
+			case Variant::OBJECT: {
+				// Test for potential wrong values sent by the debugger when it breaks.
+				Object *obj = p_variant.get_validated_object();
+				if (!obj) {
+					put_u8(Variant::NIL);
+					break;
+				}
+
+				if (!full_objects) {
+					put_u8(Variant::OBJECT | COMPACT_TAG_FLAG_OBJECT_AS_ID);
+					put_varint(uint64_t(obj->get_instance_id()));
+					break;
+				}
+
+				ERR_FAIL_COND_V(!ClassDB::can_instantiate(obj->get_class()), ERR_INVALID_PARAMETER);
+
+				put_u8(Variant::OBJECT);
+				put_string(obj->get_class());
+
+				List<PropertyInfo> props;
+				obj->get_property_list(&props);
+
+				int pc = 0;
+				for (const PropertyInfo &E : props) {
+					if (E.usage & PROPERTY_USAGE_STORAGE) {
+						pc++;
+					}
+				}
+				put_varint(pc);
+
+				for (const PropertyInfo &E : props) {
+					if (!(E.usage & PROPERTY_USAGE_STORAGE)) {
+						continue;
+					}
+
+					put_string(E.name);
+
+					Variant value;
+					if (E.name == CoreStringName(script)) {
+						Ref<Script> script = obj->get_script();
+						if (script.is_valid()) {
+							String path = script->get_path();
+							ERR_FAIL_COND_V_MSG(path.is_empty() || !path.begins_with("res://"), ERR_UNAVAILABLE, "Failed to encode a path to a custom script.");
+							value = path;
+						}
+					} else {
+						value = obj->get(E.name);
+					}
+
+					Error err = put_variant(value, p_depth + 1);
+					ERR_FAIL_COND_V(err, err);
+				}
+			} break;
+			case Variant::CALLABLE: {
+				put_u8(Variant::CALLABLE);
+			} break;
+			case Variant::SIGNAL: {
+				Signal signal = p_variant;
+				put_u8(Variant::SIGNAL);
+				put_string(signal.get_name());
+				put_varint(uint64_t(signal.get_object_id()));
+			} break;
+			case Variant::DICTIONARY: {
+				const Dictionary dict = p_variant;
+
+				uint32_t kinds = 0;
+				_encode_container_type_header(dict.get_key_type(), kinds, 0, full_objects);
+				_encode_container_type_header(dict.get_value_type(), kinds, 2, full_objects);
+				put_u8(Variant::DICTIONARY | (kinds ? COMPACT_TAG_FLAG_TYPED : 0));
+				if (kinds) {
+					put_u8(kinds);
+					Error err = put_container_type(dict.get_key_type());
+					ERR_FAIL_COND_V(err, err);
+					err = put_container_type(dict.get_value_type());
+					ERR_FAIL_COND_V(err, err);
+				}
+
+				put_varint(dict.size());
+
+				List<Variant> keys;
+				dict.get_key_list(&keys);
+
+				for (const Variant &key : keys) {
+					Error err = put_variant(key, p_depth + 1);
+					ERR_FAIL_COND_V(err, err);
+					const Variant *value = dict.getptr(key);
+					ERR_FAIL_NULL_V(value, ERR_BUG);
+					err = put_variant(*value, p_depth + 1);
+					ERR_FAIL_COND_V(err, err);
+				}
+			} break;
+			case Variant::ARRAY: {
+				const Array array = p_variant;
+
+				uint32_t kinds = 0;
+				_encode_container_type_header(array.get_element_type(), kinds, 0, full_objects);
+				put_u8(Variant::ARRAY | (kinds ? COMPACT_TAG_FLAG_TYPED : 0));
+				if (kinds) {
+					put_u8(kinds);
+					Error err = put_container_type(array.get_element_type());
+					ERR_FAIL_COND_V(err, err);
+				}
+
+				put_varint(array.size());
+
+				for (const Variant &elem : array) {
+					Error err = put_variant(elem, p_depth + 1);
+					ERR_FAIL_COND_V(err, err);
+				}
+			} break;
+
+			// Packed arrays.
+			case Variant::PACKED_BYTE_ARRAY: {
+				const Vector<uint8_t> data = p_variant;
+				put_u8(Variant::PACKED_BYTE_ARRAY);
+				put_varint(data.size());
+				put_data(data.ptr(), data.size());
+			} break;
+			case Variant::PACKED_INT32_ARRAY: {
+				const Vector<int32_t> data = p_variant;
+				put_u8(Variant::PACKED_INT32_ARRAY);
+				put_varint(data.size());
+				for (int32_t value : data) {
+					put_int(value);
+				}
+			} break;
+			case Variant::PACKED_INT64_ARRAY: {
+				const Vector<int64_t> data = p_variant;
+				put_u8(Variant::PACKED_INT64_ARRAY);
+				put_varint(data.size());
+				for (int64_t value : data) {
+					put_int(value);
+				}
+			} break;
+			case Variant::PACKED_FLOAT32_ARRAY: {
+				const Vector<float> data = p_variant;
+				put_u8(Variant::PACKED_FLOAT32_ARRAY);
+				put_varint(data.size());
+				for (float value : data) {
+					put_float(value);
+				}
+			} break;
+			case Variant::PACKED_FLOAT64_ARRAY: {
+				const Vector<double> data = p_variant;
+				put_u8(Variant::PACKED_FLOAT64_ARRAY);
+				put_varint(data.size());
+				for (double value : data) {
+					put_double(value);
+				}
+			} break;
+			case Variant::PACKED_STRING_ARRAY: {
+				const Vector<String> data = p_variant;
+				put_u8(Variant::PACKED_STRING_ARRAY);
+				put_varint(data.size());
+				for (const String &value : data) {
+					put_string(value);
+				}
+			} break;
+			case Variant::PACKED_VECTOR2_ARRAY: {
+				put_packed_vector<Vector2>(p_variant);
+			} break;
+			case Variant::PACKED_VECTOR3_ARRAY: {
+				put_packed_vector<Vector3>(p_variant);
+			} break;
+			case Variant::PACKED_VECTOR4_ARRAY: {
+				put_packed_vector<Vector4>(p_variant);
+			} break;
+			case Variant::PACKED_COLOR_ARRAY: {
+				const Vector<Color> data = p_variant;
+				put_u8(Variant::PACKED_COLOR_ARRAY);
+				put_varint(data.size());
+				for (const Color &value : data) {
+					put_float(value.r);
+					put_float(value.g);
+					put_float(value.b);
+					put_float(value.a);
+				}
+			} break;
+			default: {
+				ERR_FAIL_V(ERR_BUG);
+			}
+		}
+
+		return OK;
+	}
+
+	int get_length() const { return len; }
+
+	CompactVariantEncoder(uint8_t *p_buffer, bool p_full_objects) {
+		buf = p_buffer;
+		full_objects = p_full_objects;
+	}
+};
+
+class CompactVariantDecoder {
+	const uint8_t *buf = nullptr;
+	int len = 0;
+	int pos = 0;
+	bool allow_objects = false;
+	LocalVector<String> strings;
+
+	Error get_u8(uint8_t &r_value) {
+		ERR_FAIL_COND_V(pos >= len, ERR_INVALID_DATA);
+		r_value = buf[pos++];
+		return OK;
+	}
+
+	Error get_varint(uint64_t &r_value) {
+		r_value = 0;
+		for (int shift = 0; shift < 64; shift += 7) {
+			ERR_FAIL_COND_V(pos >= len, ERR_INVALID_DATA);
+			uint8_t byte = buf[pos++];
+			r_value |= uint64_t(byte & 0x7F) << shift;
+			if (!(byte & 0x80)) {
+				return OK;
+			}
+		}
+		ERR_FAIL_V_MSG(ERR_INVALID_DATA, "Varint is too long.");
+	}
+
+	Error get_int(int64_t &r_value) {
+		uint64_t value;
+		Error err = get_varint(value);
+		if (err) {
+			return err;
+		}
+		r_value = int64_t(value >> 1) ^ -int64_t(value & 1);
+		return OK;
+	}
+
+	// Every element takes at least `p_min_size` bytes, which bounds the count by the remaining data.
+	Error get_count(int &r_count, int p_min_size) {
+		uint64_t count;
+		Error err = get_varint(count);
+		if (err) {
+			return err;
+		}
+		ERR_FAIL_COND_V(count > uint64_t(len - pos) / p_min_size, ERR_INVALID_DATA);
+		r_count = int(count);
+		return OK;
+	}
+
+	Error get_float(float &r_value) {
+		ERR_FAIL_COND_V(len - pos < 4, ERR_INVALID_DATA);
+		r_value = decode_float(&buf[pos]);
+		pos += 4;
+		return OK;
+	}
+
+	Error get_double(double &r_value) {
+		ERR_FAIL_COND_V(len - pos < 8, ERR_INVALID_DATA);
+		r_value = decode_double(&buf[pos]);
+		pos += 8;
+		return OK;
+	}
+
+	Error get_reals(real_t *r_reals, int p_count, bool p_64) {
+		const int size = p_64 ? 8 : 4;
+		ERR_FAIL_COND_V(p_count > (len - pos) / size, ERR_INVALID_DATA);
+		for (int i = 0; i < p_count; i++) {
+			r_reals[i] = p_64 ? decode_double(&buf[pos]) : decode_float(&buf[pos]);
+			pos += size;
+		}
+		return OK;
+	}
+
+	Error get_string(String &r_string) {
+		uint64_t value;
+		Error err = get_varint(value);
+		if (err) {
+			return err;
+		}
+
+		if (value & 1) {
+			uint64_t index = value >> 1;
+			ERR_FAIL_COND_V(index >= strings.size(), ERR_INVALID_DATA);
+			r_string = strings[index];
+			return OK;
+		}
+
+		uint64_t size = value >> 1;
+		if (size == 0) {
+			r_string = String();
+			return OK;
+		}
+		ERR_FAIL_COND_V(size > uint64_t(len - pos), ERR_INVALID_DATA);
+
+		String str;
+		ERR_FAIL_COND_V(str.parse_utf8((const char *)&buf[pos], size) != OK, ERR_INVALID_DATA);
+		pos += size;
+		strings.push_back(str);
+		r_string = str;
+		return OK;
+	}
+
+	template <typename T>
+	Error get_math(Variant &r_variant, uint8_t p_tag) {
+		static_assert(sizeof(T) % sizeof(real_t) == 0);
+		T value;
+		Error err = get_reals(reinterpret_cast<real_t *>(&value), sizeof(T) / sizeof(real_t), p_tag & COMPACT_TAG_FLAG_64);
+		if (err) {
+			return err;
+		}
+		r_variant = value;
+		return OK;
+	}
+
+	template <typename T>
+	Error get_math_int(Variant &r_variant) {
+		static_assert(sizeof(T) % sizeof(int32_t) == 0);
+		T value;
+		int32_t *coords = reinterpret_cast<int32_t *>(&value);
+		for (size_t i = 0; i < sizeof(T) / sizeof(int32_t); i++) {
+			int64_t coord;
+			Error err = get_int(coord);
+			if (err) {
+				return err;
+			}
+			coords[i] = int32_t(coord);
+		}
+		r_variant = value;
+		return OK;
+	}
+
+	template <typename T>
+	Error get_packed_vector(Variant &r_variant, uint8_t p_tag) {
+		static_assert(sizeof(T) % sizeof(real_t) == 0);
+		constexpr int components = sizeof(T) / sizeof(real_t);
+		int count;
+		Error err = get_count(count, components * 4);
+		if (err) {
+			return err;
+		}
+
+		Vector<T> data;
+		data.resize(count);
+		err = get_reals(reinterpret_cast<real_t *>(data.ptrw()), count * components, p_tag & COMPACT_TAG_FLAG_64);
+		if (err) {
+			return err;
+		}
+		r_variant = data;
+		return OK;
+	}
+
+	Error get_container_type(ContainerTypeKind p_type_kind, ContainerType &r_type) {
+		switch (p_type_kind) {
+			case CONTAINER_TYPE_KIND_NONE: {
+				return OK;
+			} break;
+			case CONTAINER_TYPE_KIND_BUILTIN: {
+				uint8_t bt;
+				Error err = get_u8(bt);
+				if (err) {
+					return err;
+				}
+
+				ERR_FAIL_COND_V(bt >= Variant::VARIANT_MAX, ERR_INVALID_DATA);
+				r_type.builtin_type = (Variant::Type)bt;
+				if (!allow_objects && r_type.builtin_type == Variant::OBJECT) {
+					r_type.class_name = EncodedObjectAsID::get_class_static();
+				}
+				return OK;
+			} break;
+			case CONTAINER_TYPE_KIND_CLASS_NAME: {
+				String str;
+				Error err = get_string(str);
+				if (err) {
+					return err;
+				}
+
+				r_type.builtin_type = Variant::OBJECT;
+				if (allow_objects) {
+					r_type.class_name = str;
+				} else {
+					r_type.class_name = EncodedObjectAsID::get_class_static();
+				}
+				return OK;
+			} break;
+			case CONTAINER_TYPE_KIND_SCRIPT: {
+				String path;
+				Error err = get_string(path);
+				if (err) {
+					return err;
+				}
+
+				r_type.builtin_type = Variant::OBJECT;
+				if (allow_objects) {
+					ERR_FAIL_COND_V_MSG(path.is_empty() || !path.begins_with("res://") || !ResourceLoader::exists(path, "Script"), ERR_INVALID_DATA, vformat("Invalid script path \"%s\".", path));
+					r_type.script = ResourceLoader::load(path, "Script");
+					ERR_FAIL_COND_V_MSG(r_type.script.is_null(), ERR_INVALID_DATA, vformat("Can't load script at path \"%s\".", path));
+					r_type.class_name = r_type.script->get_instance_base_type();
+				} else {
+					r_type.class_name = EncodedObjectAsID::get_class_static();
+				}
+				return OK;
+			} break;
+		}
+		ERR_FAIL_V_MSG(ERR_INVALID_DATA, "Invalid container type kind."); // Future proofing.
+	}
+
+public:
+	Error get_variant(Variant &r_variant, int p_depth) {
+		ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Variant is too deep. Bailing.");
+
+		uint8_t tag;
+		Error err = get_u8(tag);
+		if (err) {
+			return err;
+		}
+
+		switch (tag & COMPACT_TAG_TYPE_MASK) {
+			case Variant::NIL: {
+				r_variant = Variant();
+			} break;
+			case Variant::BOOL: {
+				r_variant = bool(tag & COMPACT_TAG_FLAG_TRUE);
+			} break;
+			case Variant::INT: {
+				int64_t value = 0;
+				err = get_int(value);
+				r_variant = value;
+			} break;
+			case Variant::FLOAT: {
+				if (tag & COMPACT_TAG_FLAG_INTEGRAL) {
+					int64_t value = 0;
+					err = get_int(value);
+					r_variant = double(value);
+				} else if (tag & COMPACT_TAG_FLAG_64) {
+					double value = 0.0;
+					err = get_double(value);
+					r_variant = value;
+				} else {
+					float value = 0.0;
+					err = get_float(value);
+					r_variant = value;
+				}
+			} break;
+			case Variant::STRING: {
+				String str;
+				err = get_string(str);
+				r_variant = str;
+			} break;
+			case Variant::STRING_NAME: {
+				String str;
+				err = get_string(str);
+				r_variant = StringName(str);
+			} break;
+			case Variant::NODE_PATH: {
+				int name_count;
+				int subname_count;
+				err = get_count(name_count, 1);
+				if (err) {
+					return err;
+				}
+				err = get_count(subname_count, 1);
+				if (err) {
+					return err;
+				}
+
+				Vector<StringName> names;
+				Vector<StringName> subnames;
+				for (int i = 0; i < name_count + subname_count; i++) {
+					String str;
+					err = get_string(str);
+					if (err) {
+						return err;
+					}
+
+					if (i < name_count) {
+						names.push_back(str);
+					} else {
+						subnames.push_back(str);
+					}
+				}
+
+				r_variant = NodePath(names, subnames, tag & COMPACT_TAG_FLAG_ABSOLUTE);
+			} break;
+
+			// Math types.
+			case Variant::VECTOR2: {
+				err = get_math<Vector2>(r_variant, tag);
+			} break;
+			case Variant::RECT2: {
+				err = get_math<Rect2>(r_variant, tag);
+			} break;
+			case Variant::VECTOR3: {
+				err = get_math<Vector3>(r_variant, tag);
+			} break;
+			case Variant::VECTOR4: {
+				err = get_math<Vector4>(r_variant, tag);
+			} break;
+			case Variant::TRANSFORM2D: {
+				err = get_math<Transform2D>(r_variant, tag);
+			} break;
+			case Variant::PLANE: {
+				err = get_math<Plane>(r_variant, tag);
+			} break;
+			case Variant::QUATERNION: {
+				err = get_math<Quaternion>(r_variant, tag);
+			} break;
+			case Variant::AABB: {
+				err = get_math<AABB>(r_variant, tag);
+			} break;
+			case Variant::BASIS: {
+				err = get_math<Basis>(r_variant, tag);
+			} break;
+			case Variant::TRANSFORM3D: {
+				err = get_math<Transform3D>(r_variant, tag);
+			} break;
+			case Variant::PROJECTION: {
+				err = get_math<Projection>(r_variant, tag);
+			} break;
+			case Variant::VECTOR2I: {
+				err = get_math_int<Vector2i>(r_variant);
+			} break;
+			case Variant::RECT2I: {
+				err = get_math_int<Rect2i>(r_variant);
+			} break;
+			case Variant::VECTOR3I: {
+				err = get_math_int<Vector3i>(r_variant);
+			} break;
+			case Variant::VECTOR4I: {
+				err = get_math_int<Vector4i>(r_variant);
+			} break;
+
+			// Misc types.
+			case Variant::COLOR: {
+				Color c;
+				ERR_FAIL_COND_V(len - pos < 4 * 4, ERR_INVALID_DATA);
+				get_float(c.r);
+				get_float(c.g);
+				get_float(c.b);
+				get_float(c.a);
+				r_variant = c;
+			} break;
+			case Variant::RID: {
+				uint64_t id = 0;
+				err = get_varint(id);
+				r_variant = RID::from_uint64(id);
+			} break;
+			case Variant::OBJECT: {
+				if (tag & COMPACT_TAG_FLAG_OBJECT_AS_ID) {
+					// This _is_ allowed.
+					uint64_t id;
+					err = get_varint(id);
+					if (err) {
+						return err;
+					}
+
+					if (ObjectID(id).is_null()) {
+						r_variant = (Object *)nullptr;
+					} else {
+						Ref<EncodedObjectAsID> obj_as_id;
+						obj_as_id.instantiate();
+						obj_as_id->set_object_id(ObjectID(id));
+						r_variant = obj_as_id;
+					}
+					break;
+				}
+
+				ERR_FAIL_COND_V(!allow_objects, ERR_UNAUTHORIZED);
+
+				String class_name;
+				err = get_string(class_name);
+				if (err) {
+					return err;
+				}
+
+				ERR_FAIL_COND_V(!ClassDB::can_instantiate(class_name), ERR_INVALID_DATA);
+
+				Object *obj = ClassDB::instantiate(class_name);
+				ERR_FAIL_NULL_V(obj, ERR_UNAVAILABLE);
+
+				// Avoid premature free `RefCounted`. This must be done before properties are initialized,
+				// since script functions (setters, implicit initializer) may be called. See GH-68666.
+				Variant variant;
+				if (Object::cast_to<RefCounted>(obj)) {
+					variant = Ref<RefCounted>(Object::cast_to<RefCounted>(obj));
+				} else {
+					variant = obj;
+				}
+
+				int count;
+				err = get_count(count, 2);
+				if (err) {
+					return err;
+				}
+
+				for (int i = 0; i < count; i++) {
+					String name;
+					err = get_string(name);
+					if (err) {
+						return err;
+					}
+
+					Variant value;
+					err = get_variant(value, p_depth + 1);
+					if (err) {
+						return err;
+					}
+
+					err = _set_decoded_object_property(obj, name, value);
+					if (err) {
+						return err;
+					}
+				}
+
+				r_variant = variant;
+			} break;
+			case Variant::CALLABLE: {
+				r_variant = Callable();
+			} break;
+			case Variant::SIGNAL: {
+				String name;
+				err = get_string(name);
+				if (err) {
+					return err;
+				}
+
+				uint64_t id = 0;
+				err = get_varint(id);
+				r_variant = Signal(ObjectID(id), StringName(name));
+			} break;
+			case Variant::DICTIONARY: {
+				ContainerType key_type;
+				ContainerType value_type;
+
+				if (tag & COMPACT_TAG_FLAG_TYPED) {
+					uint8_t kinds;
+					err = get_u8(kinds);
+					if (err) {
+						return err;
+					}
+					err = get_container_type(ContainerTypeKind(kinds & 0b11), key_type);
+					if (err) {
+						return err;
+					}
+					err = get_container_type(ContainerTypeKind((kinds >> 2) & 0b11), value_type);
+					if (err) {
+						return err;
+					}
+				}
+
+				int count;
+				err = get_count(count, 2);
+				if (err) {
+					return err;
+				}
+
+				Dictionary dict;
+				if (key_type.builtin_type != Variant::NIL || value_type.builtin_type != Variant::NIL) {
+					dict.set_typed(key_type, value_type);
+				}
+
+				for (int i = 0; i < count; i++) {
+					Variant key, value;
+
+					err = get_variant(key, p_depth + 1);
+					ERR_FAIL_COND_V_MSG(err != OK, err, "Error when trying to decode Variant.");
+					err = get_variant(value, p_depth + 1);
+					ERR_FAIL_COND_V_MSG(err != OK, err, "Error when trying to decode Variant.");
+
+					dict[key] = value;
+				}
+
+				r_variant = dict;
+			} break;
+			case Variant::ARRAY: {
+				ContainerType type;
+
+				if (tag & COMPACT_TAG_FLAG_TYPED) {
+					uint8_t kinds;
+					err = get_u8(kinds);
+					if (err) {
+						return err;
+					}
+					err = get_container_type(ContainerTypeKind(kinds & 0b11), type);
+					if (err) {
+						return err;
+					}
+				}
+
+				int count;
+				err = get_count(count, 1);
+				if (err) {
+					return err;
+				}
+
+				Array array;
+				if (type.builtin_type != Variant::NIL) {
+					array.set_typed(type);
+				}
+
+				for (int i = 0; i < count; i++) {
+					Variant elem;
+					err = get_variant(elem, p_depth + 1);
+					ERR_FAIL_COND_V_MSG(err != OK, err, "Error when trying to decode Variant.");
+					array.push_back(elem);
+				}
+
+				r_variant = array;
+			} break;
+
+			// Packed arrays.
+			case Variant::PACKED_BYTE_ARRAY: {
+				int count;
+				err = get_count(count, 1);
+				if (err) {
+					return err;
+				}
+
+				Vector<uint8_t> data;
+				if (count) {
+					data.resize(count);
+					memcpy(data.ptrw(), &buf[pos], count);
+					pos += count;
+				}
+				r_variant = data;
+			} break;
+			case Variant::PACKED_INT32_ARRAY: {
+				int count;
+				err = get_count(count, 1);
+				if (err) {
+					return err;
+				}
+
+				Vector<int32_t> data;
+				data.resize(count);
+				int32_t *w = data.ptrw();
+				for (int i = 0; i < count; i++) {
+					int64_t value;
+					err = get_int(value);
+					if (err) {
+						return err;
+					}
+					w[i] = int32_t(value);
+				}
+				r_variant = data;
+			} break;
+			case Variant::PACKED_INT64_ARRAY: {
+				int count;
+				err = get_count(count, 1);
+				if (err) {
+					return err;
+				}
+
+				Vector<int64_t> data;
+				data.resize(count);
+				int64_t *w = data.ptrw();
+				for (int i = 0; i < count; i++) {
+					err = get_int(w[i]);
+					if (err) {
+						return err;
+					}
+				}
+				r_variant = data;
+			} break;
+			case Variant::PACKED_FLOAT32_ARRAY: {
+				int count;
+				err = get_count(count, 4);
+				if (err) {
+					return err;
+				}
+
+				Vector<float> data;
+				data.resize(count);
+				float *w = data.ptrw();
+				for (int i = 0; i < count; i++) {
+					get_float(w[i]);
+				}
+				r_variant = data;
+			} break;
+			case Variant::PACKED_FLOAT64_ARRAY: {
+				int count;
+				err = get_count(count, 8);
+				if (err) {
+					return err;
+				}
+
+				Vector<double> data;
+				data.resize(count);
+				double *w = data.ptrw();
+				for (int i = 0; i < count; i++) {
+					get_double(w[i]);
+				}
+				r_variant = data;
+			} break;
+			case Variant::PACKED_STRING_ARRAY: {
+				int count;
+				err = get_count(count, 1);
+				if (err) {
+					return err;
+				}
+
+				Vector<String> data;
+				data.resize(count);
+				String *w = data.ptrw();
+				for (int i = 0; i < count; i++) {
+					err = get_string(w[i]);
+					if (err) {
+						return err;
+					}
+				}
+				r_variant = data;
+			} break;
+			case Variant::PACKED_VECTOR2_ARRAY: {
+				err = get_packed_vector<Vector2>(r_variant, tag);
+			} break;
+			case Variant::PACKED_VECTOR3_ARRAY: {
+				err = get_packed_vector<Vector3>(r_variant, tag);
+			} break;
+			case Variant::PACKED_VECTOR4_ARRAY: {
+				err = get_packed_vector<Vector4>(r_variant, tag);
+			} break;
+			case Variant::PACKED_COLOR_ARRAY: {
+				int count;
+				err = get_count(count, 4 * 4);
+				if (err) {
+					return err;
+				}
+
+				Vector<Color> data;
+				data.resize(count);
+				Color *w = data.ptrw();
+				for (int i = 0; i < count; i++) {
+					get_float(w[i].r);
+					get_float(w[i].g);
+					get_float(w[i].b);
+					get_float(w[i].a);
+				}
+				r_variant = data;
+			} break;
+			default: {
+				ERR_FAIL_V(ERR_INVALID_DATA);
+			}
+		}
+
+		return err;
+	}
+
+	int get_position() const { return pos; }
+
+	CompactVariantDecoder(const uint8_t *p_buffer, int p_len, bool p_allow_objects) {
+		buf = p_buffer;
+		len = p_len;
+		allow_objects = p_allow_objects;
+	}
+};
+
+Error encode_variant_compact(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects) {
+	CompactVariantEncoder encoder(r_buffer, p_full_objects);
+	encoder.put_u8(COMPACT_ENCODING_MARKER);
+	Error err = encoder.put_variant(p_variant, 0);
+	r_len = encoder.get_length();
+	return err;
+}
+
+static Error _decode_variant_compact(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len, bool p_allow_objects) {
+	ERR_FAIL_COND_V(p_len < 1 || p_buffer[0] != COMPACT_ENCODING_MARKER, ERR_INVALID_DATA);
+
+	CompactVariantDecoder decoder(p_buffer + 1, p_len - 1, p_allow_objects);
+	Error err = decoder.get_variant(r_variant, 0);
+	if (err) {
+		return err;
+	}
+
+	if (r_len) {
+		*r_len = 1 + decoder.get_position();
+	}
+	return OK;
+}
+
 Vector<float> vector3_to_float32_array(const Vector3 *vecs, size_t count) {
 	// We always allocate a new array, and we don't `memcpy()`.
 	// We also don't consider returning a pointer to the passed vectors when `sizeof(real_t) == 4`.
@@ -224,6 +224,9 @@ public:
 
 Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len = nullptr, bool p_allow_objects = false, int p_depth = 0);
 Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects = false, int p_depth = 0);
+// Smaller encoding without padding, with varints and with repeated strings stored once.
+// `decode_variant()` recognizes it, but older versions can't decode it.
+Error encode_variant_compact(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects = false);
 
 Vector<float> vector3_to_float32_array(const Vector3 *vecs, size_t count);
 
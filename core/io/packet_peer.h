@@ -54,6 +54,7 @@ class PacketPeer : public RefCounted {
 
 	int encode_buffer_max_size = 8 * 1024 * 1024;
 	Vector<uint8_t> encode_buffer;
+	bool compact_var_encoding = false;
 
 public:
 	virtual int get_available_packet_count() const = 0;
@@ -73,6 +74,9 @@ public:
 	void set_encode_buffer_max_size(int p_max_size);
 	int get_encode_buffer_max_size() const;
 
+	void set_compact_var_encoding(bool p_enabled);
+	bool is_compact_var_encoding_enabled() const;
+
 	PacketPeer() {}
 	~PacketPeer() {}
 };
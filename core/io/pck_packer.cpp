@@ -31,9 +31,11 @@
 #include "pck_packer.h"
 
 #include "core/crypto/crypto_core.h"
+#include "core/io/compression.h"
 #include "core/io/file_access.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
+#include "core/io/marshalls.h"
 #include "core/version.h"
 
 static int _get_pad(int p_alignment, int p_n) {
@@ -46,11 +48,41 @@ static int _get_pad(int p_alignment, int p_n) {
 	return pad;
 }
 
+static Vector<uint8_t> _compress_blocks(const Vector<uint8_t> &p_data) {
+	// See the layout of compressed files in file_access_pack.h.
+	uint64_t length = p_data.size();
+	uint32_t block_count = (length + PACK_COMPRESSED_BLOCK_SIZE - 1) / PACK_COMPRESSED_BLOCK_SIZE;
+	uint64_t header_size = 16 + (uint64_t)block_count * 4;
+
+	Vector<uint8_t> out;
+	out.resize(header_size + Compression::get_max_compressed_buffer_size(PACK_COMPRESSED_BLOCK_SIZE, Compression::MODE_ZSTD) * (uint64_t)block_count);
+	uint8_t *w = out.ptrw();
+	encode_uint32(PACK_COMPRESSED_BLOCK_SIZE, w);
+	encode_uint32(block_count, w + 4);
+	encode_uint64(length, w + 8);
+
+	uint64_t ofs = header_size;
+	for (uint32_t i = 0; i < block_count; i++) {
+		uint64_t src_ofs = (uint64_t)i * PACK_COMPRESSED_BLOCK_SIZE;
+		int src_size = MIN((uint64_t)PACK_COMPRESSED_BLOCK_SIZE, length - src_ofs);
+		int dst_size = Compression::compress(w + ofs, p_data.ptr() + src_ofs, src_size, Compression::MODE_ZSTD);
+		ERR_FAIL_COND_V(dst_size < 0, Vector<uint8_t>());
+		encode_uint32(dst_size, w + 16 + i * 4);
+		ofs += dst_size;
+	}
+
+	out.resize(ofs);
+	return out;
+}
+
 void PCKPacker::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pck_start", "pck_path", "alignment", "key", "encrypt_directory"), &PCKPacker::pck_start, DEFVAL(32), DEFVAL("0000000000000000000000000000000000000000000000000000000000000000"), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("add_file", "target_path", "source_path", "encrypt"), &PCKPacker::add_file, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("add_file_removal", "target_path"), &PCKPacker::add_file_removal);
 	ClassDB::bind_method(D_METHOD("flush", "verbose"), &PCKPacker::flush, DEFVAL(false));
+
+	ClassDB::bind_method(D_METHOD("set_compression_enabled", "enabled"), &PCKPacker::set_compression_enabled);
+	ClassDB::bind_method(D_METHOD("is_compression_enabled"), &PCKPacker::is_compression_enabled);
 }
 
 Error PCKPacker::pck_start(const String &p_pck_path, int p_alignment, const String &p_key, bool p_encrypt_directory) {
@@ -90,7 +122,7 @@ Error PCKPacker::pck_start(const String &p_pck_path, int p_alignment, const Stri
 	alignment = p_alignment;
 
 	file->store_32(PACK_HEADER_MAGIC);
-	file->store_32(PACK_FORMAT_VERSION);
+	file->store_32(PACK_FORMAT_VERSION_MIN); // Updated in flush() if any file is compressed.
 	file->store_32(VERSION_MAJOR);
 	file->store_32(VERSION_MINOR);
 	file->store_32(VERSION_PATCH);
@@ -153,6 +185,13 @@ Error PCKPacker::add_file(const String &p_target_path, const String &p_source_pa
 	}
 	pf.encrypted = p_encrypt;
 
+	if (compression_enabled) {
+		pf.compressed_data = _compress_blocks(data);
+		ERR_FAIL_COND_V_MSG(pf.compressed_data.is_empty(), ERR_CANT_CREATE, vformat("Can't compress file: '%s'.", p_source_path));
+		pf.compressed = true;
+		pf.size = pf.compressed_data.size();
+	}
+
 	uint64_t _size = pf.size;
 	if (p_encrypt) { // Add encryption overhead.
 		if (_size % 16) { // Pad to encryption block size.
@@ -174,6 +213,17 @@ Error PCKPacker::add_file(const String &p_target_path, const String &p_source_pa
 Error PCKPacker::flush(bool p_verbose) {
 	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_INVALID_PARAMETER, "File must be opened before use.");
 
+	for (int i = 0; i < files.size(); i++) {
+		if (files[i].compressed) {
+			// Packs without compressed files keep the previous format version, so older engine versions can read them.
+			int64_t header_end = file->get_position();
+			file->seek(4);
+			file->store_32(PACK_FORMAT_VERSION);
+			file->seek(header_end);
+			break;
+		}
+	}
+
 	int64_t file_base_ofs = file->get_position();
 	file->store_64(0); // files base
 
@@ -219,6 +269,9 @@ Error PCKPacker::flush(bool p_verbose) {
 		if (files[i].removal) {
 			flags |= PACK_FILE_REMOVAL;
 		}
+		if (files[i].compressed) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		fhead->store_32(flags);
 	}
 
@@ -246,9 +299,6 @@ Error PCKPacker::flush(bool p_verbose) {
 			continue;
 		}
 
-		Ref<FileAccess> src = FileAccess::open(files[i].src_path, FileAccess::READ);
-		uint64_t to_write = files[i].size;
-
 		Ref<FileAccess> ftmp = file;
 		if (files[i].encrypted) {
 			fae.instantiate();
@@ -259,10 +309,16 @@ Error PCKPacker::flush(bool p_verbose) {
 			ftmp = fae;
 		}
 
-		while (to_write > 0) {
-			uint64_t read = src->get_buffer(buf, MIN(to_write, buf_max));
-			ftmp->store_buffer(buf, read);
-			to_write -= read;
+		if (files[i].compressed) {
+			ftmp->store_buffer(files[i].compressed_data.ptr(), files[i].compressed_data.size());
+		} else {
+			Ref<FileAccess> src = FileAccess::open(files[i].src_path, FileAccess::READ);
+			uint64_t to_write = files[i].size;
+			while (to_write > 0) {
+				uint64_t read = src->get_buffer(buf, MIN(to_write, buf_max));
+				ftmp->store_buffer(buf, read);
+				to_write -= read;
+			}
 		}
 
 		if (fae.is_valid()) {
@@ -287,3 +343,11 @@ Error PCKPacker::flush(bool p_verbose) {
 
 	return OK;
 }
+
+void PCKPacker::set_compression_enabled(bool p_enabled) {
+	compression_enabled = p_enabled;
+}
+
+bool PCKPacker::is_compression_enabled() const {
+	return compression_enabled;
+}
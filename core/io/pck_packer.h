@@ -44,6 +44,7 @@ class PCKPacker : public RefCounted {
 
 	Vector<uint8_t> key;
 	bool enc_dir = false;
+	bool compression_enabled = false;
 
 	static void _bind_methods();
 
@@ -54,7 +55,9 @@ class PCKPacker : public RefCounted {
 		uint64_t size = 0;
 		bool encrypted = false;
 		bool removal = false;
+		bool compressed = false;
 		Vector<uint8_t> md5;
+		Vector<uint8_t> compressed_data;
 	};
 	Vector<File> files;
 
@@ -64,6 +67,9 @@ public:
 	Error add_file_removal(const String &p_target_path);
 	Error flush(bool p_verbose = false);
 
+	void set_compression_enabled(bool p_enabled);
+	bool is_compression_enabled() const;
+
 	PCKPacker() {}
 };
 
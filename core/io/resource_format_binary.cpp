@@ -108,18 +108,23 @@ void ResourceLoaderBinary::_advance_padding(uint32_t p_len) {
 }
 
 static Error read_reals(real_t *dst, Ref<FileAccess> &f, size_t count) {
+	// Buffers are read as is, so they must be swapped when the file wasn't saved with the byte order of this platform.
+#ifdef BIG_ENDIAN_ENABLED
+	const bool swap = !f->is_big_endian();
+#else
+	const bool swap = f->is_big_endian();
+#endif
+
 	if (f->real_is_double) {
 		if constexpr (sizeof(real_t) == 8) {
 			// Ideal case with double-precision
 			f->get_buffer((uint8_t *)dst, count * sizeof(double));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint64_t *dst = (uint64_t *)dst;
+			if (swap) {
+				uint64_t *dst64 = (uint64_t *)dst;
 				for (size_t i = 0; i < count; i++) {
-					dst[i] = BSWAP64(dst[i]);
+					dst64[i] = BSWAP64(dst64[i]);
 				}
 			}
-#endif
 		} else if constexpr (sizeof(real_t) == 4) {
 			// May be slower, but this is for compatibility. Eventually the data should be converted.
 			for (size_t i = 0; i < count; ++i) {
@@ -132,14 +137,12 @@ static Error read_reals(real_t *dst, Ref<FileAccess> &f, size_t count) {
 		if constexpr (sizeof(real_t) == 4) {
 			// Ideal case with float-precision
 			f->get_buffer((uint8_t *)dst, count * sizeof(float));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint32_t *dst = (uint32_t *)dst;
+			if (swap) {
+				uint32_t *dst32 = (uint32_t *)dst;
 				for (size_t i = 0; i < count; i++) {
-					dst[i] = BSWAP32(dst[i]);
+					dst32[i] = BSWAP32(dst32[i]);
 				}
 			}
-#endif
 		} else if constexpr (sizeof(real_t) == 8) {
 			for (size_t i = 0; i < count; ++i) {
 				dst[i] = f->get_float();
@@ -197,11 +200,12 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			r_v = get_unicode_string();
 		} break;
 		case VARIANT_VECTOR2: {
+			// Math types are plain arrays of real_t in the same order as they are stored, so read them in one go.
 			Vector2 v;
-			v.x = f->get_real();
-			v.y = f->get_real();
+			static_assert(sizeof(Vector2) == 2 * sizeof(real_t));
+			const Error err = read_reals(reinterpret_cast<real_t *>(&v), f, 2);
+			ERR_FAIL_COND_V(err != OK, err);
 			r_v = v;
-
 		} break;
 		case VARIANT_VECTOR2I: {
 			Vector2i v;
@@ -212,12 +216,10 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 		case VARIANT_RECT2: {
 			Rect2 v;
-			v.position.x = f->get_real();
-			v.position.y = f->get_real();
-			v.size.x = f->get_real();
-			v.size.y = f->get_real();
+			static_assert(sizeof(Rect2) == 4 * sizeof(real_t));
+			const Error err = read_reals(reinterpret_cast<real_t *>(&v), f, 4);
+			ERR_FAIL_COND_V(err != OK, err);
 			r_v = v;
-
 		} break;
 		case VARIANT_RECT2I: {
 			Rect2i v;
@@ -230,9 +232,9 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 		case VARIANT_VECTOR3: {
 			Vector3 v;
-			v.x = f->get_real();
-			v.y = f->get_real();
-			v.z = f->get_real();
+			static_assert(sizeof(Vector3) == 3 * sizeof(real_t));
+			const Error err = read_reals(reinterpret_cast<real_t *>(&v), f, 3);
+			ERR_FAIL_COND_V(err != OK, err);
 			r_v = v;
 		} break;
 		case VARIANT_VECTOR3I: {
@@ -244,10 +246,9 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 		case VARIANT_VECTOR4: {
 			Vector4 v;
-			v.x = f->get_real();
-			v.y = f->get_real();
-			v.z = f->get_real();
-			v.w = f->get_real();
+			static_assert(sizeof(Vector4) == 4 * sizeof(real_t));
+			const Error err = read_reals(reinterpret_cast<real_t *>(&v), f, 4);
+			ERR_FAIL_COND_V(err != OK, err);
 			r_v = v;
 		} break;
 		case VARIANT_VECTOR4I: {
@@ -260,91 +261,51 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		} break;
 		case VARIANT_PLANE: {
 			Plane v;
-			v.normal.x = f->get_real();
-			v.normal.y = f->get_real();
-			v.normal.z = f->get_real();
-			v.d = f->get_real();
+			static_assert(sizeof(Plane) == 4 * sizeof(real_t));
+			const Error err = read_reals(reinterpret_cast<real_t *>(&v), f, 4);
+			ERR_FAIL_COND_V(err != OK, err);
 			r_v = v;
 		} break;
 		case VARIANT_QUATERNION: {
 			Quaternion v;
-			v.x = f->get_real();
-			v.y = f->get_real();
-			v.z = f->get_real();
-			v.w = f->get_real();
+			static_assert(sizeof(Quaternion) == 4 * sizeof(real_t));
+			const Error err = read_reals(reinterpret_cast<real_t *>(&v), f, 4);
+			ERR_FAIL_COND_V(err != OK, err);
 			r_v = v;
-
 		} break;
 		case VARIANT_AABB: {
 			AABB v;
-			v.position.x = f->get_real();
-			v.position.y = f->get_real();
-			v.position.z = f->get_real();
-			v.size.x = f->get_real();
-			v.size.y = f->get_real();
-			v.size.z = f->get_real();
+			static_assert(sizeof(AABB) == 6 * sizeof(real_t));
+			const Error err = read_reals(reinterpret_cast<real_t *>(&v), f, 6);
+			ERR_FAIL_COND_V(err != OK, err);
 			r_v = v;
-
 		} break;
 		case VARIANT_TRANSFORM2D: {
 			Transform2D v;
-			v.columns[0].x = f->get_real();
-			v.columns[0].y = f->get_real();
-			v.columns[1].x = f->get_real();
-			v.columns[1].y = f->get_real();
-			v.columns[2].x = f->get_real();
-			v.columns[2].y = f->get_real();
+			static_assert(sizeof(Transform2D) == 6 * sizeof(real_t));
+			const Error err = read_reals(reinterpret_cast<real_t *>(&v), f, 6);
+			ERR_FAIL_COND_V(err != OK, err);
 			r_v = v;
-
 		} break;
 		case VARIANT_BASIS: {
 			Basis v;
-			v.rows[0].x = f->get_real();
-			v.rows[0].y = f->get_real();
-			v.rows[0].z = f->get_real();
-			v.rows[1].x = f->get_real();
-			v.rows[1].y = f->get_real();
-			v.rows[1].z = f->get_real();
-			v.rows[2].x = f->get_real();
-			v.rows[2].y = f->get_real();
-			v.rows[2].z = f->get_real();
+			static_assert(sizeof(Basis) == 9 * sizeof(real_t));
+			const Error err = read_reals(reinterpret_cast<real_t *>(&v), f, 9);
+			ERR_FAIL_COND_V(err != OK, err);
 			r_v = v;
-
 		} break;
 		case VARIANT_TRANSFORM3D: {
 			Transform3D v;
-			v.basis.rows[0].x = f->get_real();
-			v.basis.rows[0].y = f->get_real();
-			v.basis.rows[0].z = f->get_real();
-			v.basis.rows[1].x = f->get_real();
-			v.basis.rows[1].y = f->get_real();
-			v.basis.rows[1].z = f->get_real();
-			v.basis.rows[2].x = f->get_real();
-			v.basis.rows[2].y = f->get_real();
-			v.basis.rows[2].z = f->get_real();
-			v.origin.x = f->get_real();
-			v.origin.y = f->get_real();
-			v.origin.z = f->get_real();
+			static_assert(sizeof(Transform3D) == 12 * sizeof(real_t));
+			const Error err = read_reals(reinterpret_cast<real_t *>(&v), f, 12);
+			ERR_FAIL_COND_V(err != OK, err);
 			r_v = v;
 		} break;
 		case VARIANT_PROJECTION: {
 			Projection v;
-			v.columns[0].x = f->get_real();
-			v.columns[0].y = f->get_real();
-			v.columns[0].z = f->get_real();
-			v.columns[0].w = f->get_real();
-			v.columns[1].x = f->get_real();
-			v.columns[1].y = f->get_real();
-			v.columns[1].z = f->get_real();
-			v.columns[1].w = f->get_real();
-			v.columns[2].x = f->get_real();
-			v.columns[2].y = f->get_real();
-			v.columns[2].z = f->get_real();
-			v.columns[2].w = f->get_real();
-			v.columns[3].x = f->get_real();
-			v.columns[3].y = f->get_real();
-			v.columns[3].z = f->get_real();
-			v.columns[3].w = f->get_real();
+			static_assert(sizeof(Projection) == 16 * sizeof(real_t));
+			const Error err = read_reals(reinterpret_cast<real_t *>(&v), f, 16);
+			ERR_FAIL_COND_V(err != OK, err);
 			r_v = v;
 		} break;
 		case VARIANT_COLOR: {
@@ -407,6 +368,17 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 						path += res_path + "::" + itos(index);
 					}
 
+					// The main resource is never loaded on demand, like in full loads it's not available to the resources it holds.
+					if (load_on_demand && using_named_scene_ids && (int)index != internal_resources.size() - 1 && !internal_index_cache.has(path)) {
+						uint64_t pos = f->get_position();
+						Error err = _load_internal_resource(index);
+						if (err != OK) {
+							return err;
+						}
+						f->seek(pos);
+						path = internal_resources[index].path; // Updated when loaded.
+					}
+
 					//always use internal cache for loading internal resources
 					if (!internal_index_cache.has(path)) {
 						WARN_PRINT(vformat("Couldn't load resource (no cache): %s.", path));
@@ -446,6 +418,12 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 						WARN_PRINT("Broken external resource! (index out of size)");
 						r_v = Variant();
 					} else {
+						if (load_on_demand && !external_resources[erindex].load_started) {
+							Error err = _start_external_load(erindex);
+							if (err != OK) {
+								return err;
+							}
+						}
 						Ref<ResourceLoader::LoadToken> &load_token = external_resources.write[erindex].load_token;
 						if (load_token.is_valid()) { // If not valid, it's OK since then we know this load accepts broken dependencies.
 							Error err;
@@ -684,223 +662,268 @@ Error ResourceLoaderBinary::load() {
 	}
 
 	for (int i = 0; i < external_resources.size(); i++) {
-		String path = external_resources[i].path;
+		Error err = _start_external_load(i);
+		if (err != OK) {
+			return err;
+		}
+	}
 
-		if (remaps.has(path)) {
-			path = remaps[path];
+	for (int i = 0; i < internal_resources.size(); i++) {
+		Error err = _load_internal_resource(i);
+		if (err != OK) {
+			return err;
 		}
 
-		if (!path.contains("://") && path.is_relative_path()) {
-			// path is relative to file being loaded, so convert to a resource path
-			path = ProjectSettings::get_singleton()->localize_path(path.get_base_dir().path_join(external_resources[i].path));
+		if (progress) {
+			*progress = (i + 1) / float(internal_resources.size());
 		}
 
-		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
-		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
-		if (external_resources[i].load_token.is_null()) {
-			if (!ResourceLoader::get_abort_on_missing_resources()) {
-				ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
-			} else {
-				error = ERR_FILE_MISSING_DEPENDENCIES;
-				ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", path));
-			}
+		if (resource.is_valid()) { // The main resource, which is the last one.
+			return OK;
 		}
 	}
 
-	for (int i = 0; i < internal_resources.size(); i++) {
-		bool main = i == (internal_resources.size() - 1);
+	return ERR_FILE_EOF;
+}
+
+Error ResourceLoaderBinary::load_sub_resource(const String &p_id) {
+	if (error != OK) {
+		return error;
+	}
+	ERR_FAIL_COND_V_MSG(!using_named_scene_ids, ERR_UNAVAILABLE, vformat("'%s': Built-in resources can't be loaded on their own from this format version.", local_path));
 
-		//maybe it is loaded already
-		String path;
-		String id;
+	// Only the requested resource and what it references are loaded, using the offsets in the header.
+	// External resources are started when first referenced.
+	load_on_demand = true;
+	for (int i = 0; i < internal_resources.size() - 1; i++) {
+		if (internal_resources[i].path == "local://" + p_id) {
+			Error err = _load_internal_resource(i);
+			if (err != OK) {
+				return err;
+			}
+			f.unref();
+			resource = internal_index_cache[internal_resources[i].path];
+			return OK;
+		}
+	}
 
-		if (!main) {
-			path = internal_resources[i].path;
+	error = ERR_FILE_NOT_FOUND;
+	ERR_FAIL_V_MSG(error, vformat("'%s': No built-in resource with ID '%s'.", local_path, p_id));
+}
 
-			if (path.begins_with("local://")) {
-				path = path.replace_first("local://", "");
-				id = path;
-				path = res_path + "::" + path;
+Error ResourceLoaderBinary::_start_external_load(int p_index) {
+	String path = external_resources[p_index].path;
 
-				internal_resources.write[i].path = path; // Update path.
-			}
+	if (remaps.has(path)) {
+		path = remaps[path];
+	}
 
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached.is_valid()) {
-					//already loaded, don't do anything
-					error = OK;
-					internal_index_cache[path] = cached;
-					continue;
-				}
-			}
+	if (!path.contains("://") && path.is_relative_path()) {
+		// path is relative to file being loaded, so convert to a resource path
+		path = ProjectSettings::get_singleton()->localize_path(path.get_base_dir().path_join(external_resources[p_index].path));
+	}
+
+	external_resources.write[p_index].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
+	external_resources.write[p_index].load_started = true;
+	external_resources.write[p_index].load_token = ResourceLoader::_load_start(path, external_resources[p_index].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
+	if (external_resources[p_index].load_token.is_null()) {
+		if (!ResourceLoader::get_abort_on_missing_resources()) {
+			ResourceLoader::notify_dependency_error(local_path, path, external_resources[p_index].type);
 		} else {
-			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
-				path = res_path;
-			}
+			error = ERR_FILE_MISSING_DEPENDENCIES;
+			ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", path));
 		}
+	}
+	return OK;
+}
 
-		uint64_t offset = internal_resources[i].offset;
-
-		f->seek(offset);
+Error ResourceLoaderBinary::_load_internal_resource(int p_index) {
+	bool main = p_index == (internal_resources.size() - 1);
 
-		String t = get_unicode_string();
+	//maybe it is loaded already
+	String path;
+	String id;
 
-		Ref<Resource> res;
-		Resource *r = nullptr;
+	if (!main) {
+		path = internal_resources[p_index].path;
 
-		MissingResource *missing_resource = nullptr;
+		if (path.begins_with("local://")) {
+			path = path.replace_first("local://", "");
+			id = path;
+			path = res_path + "::" + path;
 
-		if (main) {
-			res = ResourceLoader::get_resource_ref_override(local_path);
-			r = res.ptr();
+			internal_resources.write[p_index].path = path; // Update path.
 		}
-		if (!r) {
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
-				//use the existing one
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached->get_class() == t) {
-					cached->reset_state();
-					res = cached;
-				}
+
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached.is_valid()) {
+				//already loaded, don't do anything
+				error = OK;
+				internal_index_cache[path] = cached;
+				return OK;
 			}
+		}
+	} else {
+		if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
+			path = res_path;
+		}
+	}
 
-			if (res.is_null()) {
-				//did not replace
-
-				Object *obj = ClassDB::instantiate(t);
-				if (!obj) {
-					if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-						//create a missing resource
-						missing_resource = memnew(MissingResource);
-						missing_resource->set_original_class(t);
-						missing_resource->set_recording_properties(true);
-						obj = missing_resource;
-					} else {
-						error = ERR_FILE_CORRUPT;
-						ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource of unrecognized type in file: '%s'.", local_path, t));
-					}
-				}
+	uint64_t offset = internal_resources[p_index].offset;
 
-				r = Object::cast_to<Resource>(obj);
-				if (!r) {
-					String obj_class = obj->get_class();
-					error = ERR_FILE_CORRUPT;
-					memdelete(obj); //bye
-					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource type in resource field not a resource, type is: %s.", local_path, obj_class));
-				}
+	f->seek(offset);
+
+	String t = get_unicode_string();
+
+	Ref<Resource> res;
+	Resource *r = nullptr;
 
-				res = Ref<Resource>(r);
+	MissingResource *missing_resource = nullptr;
+
+	if (main) {
+		res = ResourceLoader::get_resource_ref_override(local_path);
+		r = res.ptr();
+	}
+	if (!r) {
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
+			//use the existing one
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached->get_class() == t) {
+				cached->reset_state();
+				res = cached;
 			}
 		}
 
-		if (r) {
-			if (!path.is_empty()) {
-				if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
-					r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); // If got here because the resource with same path has different type, replace it.
+		if (res.is_null()) {
+			//did not replace
+
+			Object *obj = ClassDB::instantiate(t);
+			if (!obj) {
+				if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+					//create a missing resource
+					missing_resource = memnew(MissingResource);
+					missing_resource->set_original_class(t);
+					missing_resource->set_recording_properties(true);
+					obj = missing_resource;
 				} else {
-					r->set_path_cache(path);
+					error = ERR_FILE_CORRUPT;
+					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource of unrecognized type in file: '%s'.", local_path, t));
 				}
 			}
-			r->set_scene_unique_id(id);
+
+			r = Object::cast_to<Resource>(obj);
+			if (!r) {
+				String obj_class = obj->get_class();
+				error = ERR_FILE_CORRUPT;
+				memdelete(obj); //bye
+				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource type in resource field not a resource, type is: %s.", local_path, obj_class));
+			}
+
+			res = Ref<Resource>(r);
 		}
+	}
 
-		if (!main) {
-			internal_index_cache[path] = res;
+	if (r) {
+		if (!path.is_empty()) {
+			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
+				r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); // If got here because the resource with same path has different type, replace it.
+			} else {
+				r->set_path_cache(path);
+			}
 		}
+		r->set_scene_unique_id(id);
+	}
 
-		int pc = f->get_32();
+	if (!main) {
+		internal_index_cache[path] = res;
+	}
 
-		//set properties
+	int pc = f->get_32();
 
-		Dictionary missing_resource_properties;
+	//set properties
 
-		for (int j = 0; j < pc; j++) {
-			StringName name = _get_string();
+	Dictionary missing_resource_properties;
 
-			if (name == StringName()) {
-				error = ERR_FILE_CORRUPT;
-				ERR_FAIL_V(ERR_FILE_CORRUPT);
-			}
+	for (int j = 0; j < pc; j++) {
+		StringName name = _get_string();
 
-			Variant value;
+		if (name == StringName()) {
+			error = ERR_FILE_CORRUPT;
+			ERR_FAIL_V(ERR_FILE_CORRUPT);
+		}
 
-			error = parse_variant(value);
-			if (error) {
-				return error;
-			}
+		Variant value;
 
-			bool set_valid = true;
-			if (value.get_type() == Variant::OBJECT && missing_resource == nullptr && ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-				// If the property being set is a missing resource (and the parent is not),
-				// then setting it will most likely not work.
-				// Instead, save it as metadata.
+		error = parse_variant(value);
+		if (error) {
+			return error;
+		}
 
-				Ref<MissingResource> mr = value;
-				if (mr.is_valid()) {
-					missing_resource_properties[name] = mr;
-					set_valid = false;
-				}
-			}
+		bool set_valid = true;
+		if (value.get_type() == Variant::OBJECT && missing_resource == nullptr && ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+			// If the property being set is a missing resource (and the parent is not),
+			// then setting it will most likely not work.
+			// Instead, save it as metadata.
 
-			if (value.get_type() == Variant::ARRAY) {
-				Array set_array = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
-					Array get_array = get_value;
-					if (!set_array.is_same_typed(get_array)) {
-						value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
-					}
-				}
+			Ref<MissingResource> mr = value;
+			if (mr.is_valid()) {
+				missing_resource_properties[name] = mr;
+				set_valid = false;
 			}
+		}
 
-			if (value.get_type() == Variant::DICTIONARY) {
-				Dictionary set_dict = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
-					Dictionary get_dict = get_value;
-					if (!set_dict.is_same_typed(get_dict)) {
-						value = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(),
-								get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
-					}
+		if (value.get_type() == Variant::ARRAY) {
+			Array set_array = value;
+			bool is_get_valid = false;
+			Variant get_value = res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
+				Array get_array = get_value;
+				if (!set_array.is_same_typed(get_array)) {
+					value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
 				}
 			}
+		}
 
-			if (set_valid) {
-				res->set(name, value);
+		if (value.get_type() == Variant::DICTIONARY) {
+			Dictionary set_dict = value;
+			bool is_get_valid = false;
+			Variant get_value = res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
+				Dictionary get_dict = get_value;
+				if (!set_dict.is_same_typed(get_dict)) {
+					value = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(),
+							get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
+				}
 			}
 		}
 
-		if (missing_resource) {
-			missing_resource->set_recording_properties(false);
+		if (set_valid) {
+			res->set(name, value);
 		}
+	}
 
-		if (!missing_resource_properties.is_empty()) {
-			res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
-		}
+	if (missing_resource) {
+		missing_resource->set_recording_properties(false);
+	}
+
+	if (!missing_resource_properties.is_empty()) {
+		res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+	}
 
 #ifdef TOOLS_ENABLED
-		res->set_edited(false);
+	res->set_edited(false);
 #endif
 
-		if (progress) {
-			*progress = (i + 1) / float(internal_resources.size());
-		}
-
-		resource_cache.push_back(res);
+	resource_cache.push_back(res);
 
-		if (main) {
-			f.unref();
-			resource = res;
-			resource->set_as_translation_remapped(translation_remapped);
-			error = OK;
-			return OK;
-		}
+	if (main) {
+		f.unref();
+		resource = res;
+		resource->set_as_translation_remapped(translation_remapped);
+		error = OK;
 	}
-
-	return ERR_FILE_EOF;
+	return OK;
 }
 
 void ResourceLoaderBinary::set_translation_remapped(bool p_remapped) {
@@ -1219,10 +1242,14 @@ Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const Strin
 		*r_error = ERR_FILE_CANT_OPEN;
 	}
 
+	// A built-in resource can be loaded on its own with a path like "res://file.res::id".
+	String file_path = p_path.get_slice("::", 0);
+	String sub_resource_id = p_path.contains("::") ? p_path.get_slice("::", 1) : String();
+
 	Error err;
-	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
+	Ref<FileAccess> f = FileAccess::open(file_path, FileAccess::READ, &err);
 
-	ERR_FAIL_COND_V_MSG(err != OK, Ref<Resource>(), vformat("Cannot open file '%s'.", p_path));
+	ERR_FAIL_COND_V_MSG(err != OK, Ref<Resource>(), vformat("Cannot open file '%s'.", file_path));
 
 	ResourceLoaderBinary loader;
 	switch (p_cache_mode) {
@@ -1243,12 +1270,16 @@ Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const Strin
 	}
 	loader.use_sub_threads = p_use_sub_threads;
 	loader.progress = r_progress;
-	String path = !p_original_path.is_empty() ? p_original_path : p_path;
+	String path = !p_original_path.is_empty() ? p_original_path.get_slice("::", 0) : file_path;
 	loader.local_path = ProjectSettings::get_singleton()->localize_path(path);
 	loader.res_path = loader.local_path;
 	loader.open(f);
 
-	err = loader.load();
+	if (sub_resource_id.is_empty()) {
+		err = loader.load();
+	} else {
+		err = loader.load_sub_resource(sub_resource_id);
+	}
 
 	if (r_error) {
 		*r_error = err;
@@ -1293,6 +1324,11 @@ void ResourceFormatLoaderBinary::get_recognized_extensions(List<String> *p_exten
 	}
 }
 
+bool ResourceFormatLoaderBinary::recognize_path(const String &p_path, const String &p_for_type) const {
+	// Built-in resources are recognized by the file containing them.
+	return ResourceFormatLoader::recognize_path(p_path.get_slice("::", 0), p_for_type);
+}
+
 bool ResourceFormatLoaderBinary::handles_type(const String &p_type) const {
 	return true; //handles all
 }
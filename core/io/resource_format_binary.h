@@ -61,6 +61,7 @@ class ResourceLoaderBinary {
 		String type;
 		ResourceUID::ID uid = ResourceUID::INVALID_ID;
 		Ref<ResourceLoader::LoadToken> load_token;
+		bool load_started = false;
 	};
 
 	bool using_named_scene_ids = false;
@@ -77,6 +78,7 @@ class ResourceLoaderBinary {
 
 	Vector<IntResource> internal_resources;
 	HashMap<String, Ref<Resource>> internal_index_cache;
+	bool load_on_demand = false; // Load internal and external resources when first referenced.
 
 	String get_unicode_string();
 	void _advance_padding(uint32_t p_len);
@@ -90,12 +92,15 @@ class ResourceLoaderBinary {
 	friend class ResourceFormatLoaderBinary;
 
 	Error parse_variant(Variant &r_v);
+	Error _start_external_load(int p_index);
+	Error _load_internal_resource(int p_index);
 
 	HashMap<String, Ref<Resource>> dependency_cache;
 
 public:
 	Ref<Resource> get_resource();
 	Error load();
+	Error load_sub_resource(const String &p_id);
 	void set_translation_remapped(bool p_remapped);
 
 	void set_remaps(const HashMap<String, String> &p_remaps) { remaps = p_remaps; }
@@ -113,6 +118,7 @@ public:
 	virtual Ref<Resource> load(const String &p_path, const String &p_original_path = "", Error *r_error = nullptr, bool p_use_sub_threads = false, float *r_progress = nullptr, CacheMode p_cache_mode = CACHE_MODE_REUSE) override;
 	virtual void get_recognized_extensions_for_type(const String &p_type, List<String> *p_extensions) const override;
 	virtual void get_recognized_extensions(List<String> *p_extensions) const override;
+	virtual bool recognize_path(const String &p_path, const String &p_for_type = String()) const override;
 	virtual bool handles_type(const String &p_type) const override;
 	virtual String get_resource_type(const String &p_path) const override;
 	virtual String get_resource_script_class(const String &p_path) const override;
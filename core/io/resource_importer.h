@@ -150,6 +150,8 @@ public:
 
 	virtual Error import(ResourceUID::ID p_source_id, const String &p_source_file, const String &p_save_path, const HashMap<StringName, Variant> &p_options, List<String> *r_platform_variants, List<String> *r_gen_files = nullptr, Variant *r_metadata = nullptr) = 0;
 	virtual bool can_import_threaded() const { return false; }
+	// Whether the imported files only depend on the source file, the options and the import settings string, so they can be reused from the import cache.
+	virtual bool can_cache_import(const HashMap<StringName, Variant> &p_options) const { return false; }
 	virtual void import_threaded_begin() {}
 	virtual void import_threaded_end() {}
 
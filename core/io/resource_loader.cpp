@@ -385,6 +385,12 @@ void ResourceLoader::_run_load_task(void *p_userdata) {
 	bool xl_remapped = false;
 	const String &remapped_path = _path_remap(load_task.local_path, &xl_remapped);
 
+	// Kept until the resource is loaded, so the prefetched dependencies stay in the cache.
+	LocalVector<Ref<LoadToken>> dependency_tokens;
+	if (load_task.prefetch_dependencies) {
+		_prefetch_dependencies(load_task.local_path, dependency_tokens);
+	}
+
 	Error load_err = OK;
 	Ref<Resource> res = _load(remapped_path, remapped_path != load_task.local_path ? load_task.local_path : String(), load_task.type_hint, load_task.cache_mode, &load_err, load_task.use_sub_threads, &load_task.progress);
 	if (MessageQueue::get_singleton() != MessageQueue::get_main_singleton()) {
@@ -478,11 +484,20 @@ void ResourceLoader::_run_load_task(void *p_userdata) {
 	}
 
 	// It's safe now to let the task go in case no one else was grabbing the token.
-	load_task.load_token->unreference();
-
-	if (unlock_pending) {
-		thread_load_mutex.unlock();
+	// Once the token is released, another load of the same path may clear the task at any time, so it's only touched under the lock.
+	if (!unlock_pending) {
+		thread_load_mutex.lock();
+	}
+	LoadToken *load_token = load_task.load_token;
+	bool orphaned = load_token->unreference();
+	if (orphaned) {
+		// The request was cancelled while loading, so nobody wants the result. The token can't be freed here,
+		// since that awaits this very task, but the resource can be released right away.
+		res = load_task.resource;
+		load_task.resource.unref();
+		orphan_load_tokens.push_back(load_token);
 	}
+	thread_load_mutex.unlock();
 
 	if (load_nesting == 0) {
 		if (own_mq_override) {
@@ -492,9 +507,54 @@ void ResourceLoader::_run_load_task(void *p_userdata) {
 		DEV_ASSERT(load_paths_stack.is_empty());
 	}
 
+	if (orphaned) {
+		// The token is freed from the main thread once this task is over, or on the next user request, whatever comes first.
+		MessageQueue::get_main_singleton()->push_callable(callable_mp_static(&ResourceLoader::_free_orphan_load_tokens));
+	}
+
 	curr_load_task = curr_load_task_backup;
 }
 
+// Reads the dependency tree from the resource headers and starts loading all of it at once, deepest dependencies first.
+// Loaders requesting one of these dependencies later just await the task already in flight, instead of
+// discovering the tree one level at a time.
+void ResourceLoader::_prefetch_dependencies(const String &p_path, LocalVector<Ref<LoadToken>> &r_tokens) {
+	LocalVector<String> tree;
+	HashSet<String> visited;
+	tree.push_back(p_path);
+	visited.insert(p_path);
+
+	for (uint32_t i = 0; i < tree.size(); i++) {
+		List<String> dependencies;
+		get_dependencies(tree[i], &dependencies, true);
+
+		for (const String &dependency : dependencies) {
+			// Dependencies are given as "path::type", or "uid::type::fallback_path".
+			String dependency_path = dependency.get_slice("::", 0);
+			if (dependency_path.begins_with("uid://")) {
+				ResourceUID::ID uid = ResourceUID::get_singleton()->text_to_id(dependency_path);
+				dependency_path = ResourceUID::get_singleton()->has_id(uid) ? ResourceUID::get_singleton()->get_id_path(uid) : dependency.get_slice("::", 2);
+			}
+			if (dependency_path.is_empty()) {
+				continue;
+			}
+
+			dependency_path = _validate_local_path(dependency_path);
+			if (!visited.has(dependency_path) && !ResourceCache::has(dependency_path)) {
+				visited.insert(dependency_path);
+				tree.push_back(dependency_path);
+			}
+		}
+	}
+
+	for (int i = (int)tree.size() - 1; i > 0; i--) {
+		Ref<LoadToken> token = _load_start(tree[i], String(), LOAD_THREAD_DISTRIBUTE, ResourceFormatLoader::CACHE_MODE_REUSE);
+		if (token.is_valid()) {
+			r_tokens.push_back(token);
+		}
+	}
+}
+
 String ResourceLoader::_validate_local_path(const String &p_path) {
 	ResourceUID::ID uid = ResourceUID::get_singleton()->text_to_id(p_path);
 	if (uid != ResourceUID::INVALID_ID) {
@@ -507,6 +567,8 @@ String ResourceLoader::_validate_local_path(const String &p_path) {
 }
 
 Error ResourceLoader::load_threaded_request(const String &p_path, const String &p_type_hint, bool p_use_sub_threads, ResourceFormatLoader::CacheMode p_cache_mode) {
+	_free_orphan_load_tokens();
+
 	Ref<ResourceLoader::LoadToken> token = _load_start(p_path, p_type_hint, p_use_sub_threads ? LOAD_THREAD_DISTRIBUTE : LOAD_THREAD_SPAWN_SINGLE, p_cache_mode, true);
 	return token.is_valid() ? OK : FAILED;
 }
@@ -531,6 +593,99 @@ void ResourceLoader::_load_threaded_request_setup_user_token(LoadToken *p_token,
 	print_lt("REQUEST: user load tokens: " + itos(user_load_tokens.size()));
 }
 
+Error ResourceLoader::load_threaded_cancel(const String &p_path) {
+	{
+		MutexLock thread_load_lock(thread_load_mutex);
+
+		if (!user_load_tokens.has(p_path)) {
+			print_verbose("load_threaded_cancel(): No threaded load for resource path '" + p_path + "' has been initiated or its result has already been collected.");
+			return ERR_INVALID_PARAMETER;
+		}
+
+		LoadToken *load_token = user_load_tokens[p_path];
+		DEV_ASSERT(load_token->user_rc >= 1);
+
+		load_token->user_rc--;
+		if (load_token->user_rc == 0) {
+			load_token->user_path.clear();
+			user_load_tokens.erase(p_path);
+
+			// If nobody else needs the resource and it's still queued, the task is dropped. Otherwise,
+			// the load can't be interrupted, and the resource is discarded once loaded if still unused.
+			ThreadLoadTask *load_task = load_token->task_if_unregistered ? load_token->task_if_unregistered : thread_load_tasks.getptr(load_token->local_path);
+			bool only_user_and_task = load_token->get_reference_count() == 2;
+			if (load_task && load_task->status == THREAD_LOAD_IN_PROGRESS && load_task->task_id && only_user_and_task) {
+				if (WorkerThreadPool::get_singleton()->cancel_task(load_task->task_id)) {
+					load_task->task_id = 0;
+					load_task->status = THREAD_LOAD_FAILED;
+					load_task->error = ERR_SKIP;
+					load_task->need_wait = false;
+					load_token->unreference(); // The reference held by the task.
+				}
+			}
+
+			if (load_token->unreference()) {
+				memdelete(load_token);
+			}
+		}
+	}
+
+	_free_orphan_load_tokens();
+	return OK;
+}
+
+Error ResourceLoader::load_threaded_prioritize(const String &p_path) {
+	MutexLock thread_load_lock(thread_load_mutex);
+
+	if (!user_load_tokens.has(p_path)) {
+		print_verbose("load_threaded_prioritize(): No threaded load for resource path '" + p_path + "' has been initiated or its result has already been collected.");
+		return ERR_INVALID_PARAMETER;
+	}
+
+	LoadToken *load_token = user_load_tokens[p_path];
+	if (load_token->task_if_unregistered) {
+		if (load_token->task_if_unregistered->status == THREAD_LOAD_IN_PROGRESS && load_token->task_if_unregistered->task_id) {
+			WorkerThreadPool::get_singleton()->raise_task_priority(load_token->task_if_unregistered->task_id);
+		}
+	} else if (!load_token->local_path.is_empty()) {
+		HashSet<String> visited;
+		_raise_load_priority(load_token->local_path, visited);
+	}
+	return OK;
+}
+
+// Loads start as low priority tasks; this moves the ones still queued, with the dependencies they are awaiting, to the regular queue.
+void ResourceLoader::_raise_load_priority(const String &p_local_path, HashSet<String> &r_visited) {
+	ThreadLoadTask *load_task = thread_load_tasks.getptr(p_local_path);
+	if (!load_task || load_task->status != THREAD_LOAD_IN_PROGRESS || r_visited.has(p_local_path)) {
+		return;
+	}
+	r_visited.insert(p_local_path);
+
+	if (load_task->task_id) {
+		WorkerThreadPool::get_singleton()->raise_task_priority(load_task->task_id);
+	}
+	for (const String &E : load_task->sub_tasks) {
+		_raise_load_priority(E, r_visited);
+	}
+}
+
+void ResourceLoader::_free_orphan_load_tokens() {
+	LocalVector<LoadToken *> tokens;
+	{
+		MutexLock thread_load_lock(thread_load_mutex);
+		if (orphan_load_tokens.is_empty()) {
+			return;
+		}
+		tokens = orphan_load_tokens;
+		orphan_load_tokens.clear();
+	}
+
+	for (LoadToken *load_token : tokens) {
+		memdelete(load_token);
+	}
+}
+
 Ref<Resource> ResourceLoader::load(const String &p_path, const String &p_type_hint, ResourceFormatLoader::CacheMode p_cache_mode, Error *r_error) {
 	if (r_error) {
 		*r_error = OK;
@@ -605,6 +760,8 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 			load_task.type_hint = p_type_hint;
 			load_task.cache_mode = p_cache_mode;
 			load_task.use_sub_threads = p_thread_mode == LOAD_THREAD_DISTRIBUTE;
+			// Dependencies are shared with the cache, unless the load must bypass it for the whole tree.
+			load_task.prefetch_dependencies = p_for_user && load_task.use_sub_threads && p_cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE_DEEP && p_cache_mode != ResourceFormatLoader::CACHE_MODE_REPLACE_DEEP;
 			if (p_cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE) {
 				Ref<Resource> existing = ResourceCache::get_ref(local_path);
 				if (existing.is_valid()) {
@@ -1374,6 +1531,11 @@ void ResourceLoader::clear_thread_load_tasks() {
 		thread_load_lock.temp_relock();
 	}
 
+	// Tokens of loads cancelled while running are only referenced from here. Freeing them takes the lock.
+	thread_load_lock.temp_unlock();
+	_free_orphan_load_tokens();
+	thread_load_lock.temp_relock();
+
 	while (user_load_tokens.begin()) {
 		LoadToken *user_token = user_load_tokens.begin()->value;
 		user_load_tokens.remove(user_load_tokens.begin());
@@ -1567,6 +1729,7 @@ HashMap<String, ResourceLoader::ThreadLoadTask> ResourceLoader::thread_load_task
 bool ResourceLoader::cleaning_tasks = false;
 
 HashMap<String, ResourceLoader::LoadToken *> ResourceLoader::user_load_tokens;
+LocalVector<ResourceLoader::LoadToken *> ResourceLoader::orphan_load_tokens;
 
 SelfList<Resource>::List ResourceLoader::remapped_list;
 HashMap<String, Vector<String>> ResourceLoader::translation_remaps;
@@ -193,6 +193,7 @@ private:
 		Error error = OK;
 		Ref<Resource> resource;
 		bool use_sub_threads = false;
+		bool prefetch_dependencies = false; // Start the loads of the whole dependency tree before loading the resource itself.
 		HashSet<String> sub_tasks;
 
 		struct ResourceChangedConnection {
@@ -204,6 +205,7 @@ private:
 	};
 
 	static void _run_load_task(void *p_userdata);
+	static void _prefetch_dependencies(const String &p_path, LocalVector<Ref<LoadToken>> &r_tokens);
 
 	static thread_local int load_nesting;
 	static thread_local HashMap<int, HashMap<String, Ref<Resource>>> res_ref_overrides; // Outermost key is nesting level.
@@ -217,6 +219,10 @@ private:
 	static bool cleaning_tasks;
 
 	static HashMap<String, LoadToken *> user_load_tokens;
+	static LocalVector<LoadToken *> orphan_load_tokens; // Of loads cancelled while running, freed once their task is over.
+
+	static void _free_orphan_load_tokens();
+	static void _raise_load_priority(const String &p_local_path, HashSet<String> &r_visited);
 
 	static float _dependency_get_progress(const String &p_path);
 
@@ -228,6 +234,8 @@ public:
 	static Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, ResourceFormatLoader::CacheMode p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE);
 	static ThreadLoadStatus load_threaded_get_status(const String &p_path, float *r_progress = nullptr);
 	static Ref<Resource> load_threaded_get(const String &p_path, Error *r_error = nullptr);
+	static Error load_threaded_cancel(const String &p_path);
+	static Error load_threaded_prioritize(const String &p_path);
 
 	static bool is_within_load() { return load_nesting > 0; }
 
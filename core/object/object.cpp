@@ -1183,31 +1183,29 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 	// which is needed in certain edge cases; e.g., https://github.com/godotengine/godot/issues/73889.
 	Ref<RefCounted> rc = Ref<RefCounted>(Object::cast_to<RefCounted>(this));
 
-	// Ensure that disconnecting the signal or even deleting the object
-	// will not affect the signal calling.
-	Callable *slot_callables = (Callable *)alloca(sizeof(Callable) * s->slot_map.size());
-	uint32_t *slot_flags = (uint32_t *)alloca(sizeof(uint32_t) * s->slot_map.size());
-	uint32_t slot_count = 0;
-
-	for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-		memnew_placement(&slot_callables[slot_count], Callable(slot_kv.value.conn.callable));
-		slot_flags[slot_count] = slot_kv.value.conn.flags;
-		++slot_count;
+	if (s->emit_slots_dirty) {
+		s->update_emit_slots();
 	}
 
-	DEV_ASSERT(slot_count == s->slot_map.size());
+	// Ensure that disconnecting the signal or even deleting the object
+	// will not affect the signal calling. The copy only shares the array.
+	const Vector<SignalData::EmitSlot> emit_slots = s->emit_slots;
+	const SignalData::EmitSlot *slots = emit_slots.ptr();
+	const uint32_t slot_count = emit_slots.size();
 
 	// Disconnect all one-shot connections before emitting to prevent recursion.
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		bool disconnect = slot_flags[i] & CONNECT_ONE_SHOT;
+	if (s->has_one_shot) {
+		for (uint32_t i = 0; i < slot_count; ++i) {
+			bool disconnect = slots[i].flags & CONNECT_ONE_SHOT;
 #ifdef TOOLS_ENABLED
-		if (disconnect && (slot_flags[i] & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
-			// This signal was connected from the editor, and is being edited. Just don't disconnect for now.
-			disconnect = false;
-		}
+			if (disconnect && (slots[i].flags & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
+				// This signal was connected from the editor, and is being edited. Just don't disconnect for now.
+				disconnect = false;
+			}
 #endif
-		if (disconnect) {
-			_disconnect(p_name, slot_callables[i]);
+			if (disconnect) {
+				_disconnect(p_name, slots[i].callable);
+			}
 		}
 	}
 
@@ -1216,17 +1214,44 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 	Error err = OK;
 
 	for (uint32_t i = 0; i < slot_count; ++i) {
-		const Callable &callable = slot_callables[i];
-		const uint32_t &flags = slot_flags[i];
+		const Callable &callable = slots[i].callable;
+		const uint32_t &flags = slots[i].flags;
+
+		const Variant **args = p_args;
+		int argc = p_argcount;
+
+		if (slots[i].method && !(flags & CONNECT_DEFERRED)) {
+			// Native method on a target without script, skip looking the method up again.
+			Object *target = ObjectDB::get_instance(callable.get_object_id());
+			if (target && !target->script_instance) {
+				Callable::CallError ce;
+				_emitting = true;
+				{
+#ifdef DEBUG_ENABLED
+					_ObjectDebugLock target_lock(target);
+#endif
+					slots[i].method->call(target, args, argc, ce);
+				}
+				_emitting = false;
+
+				if (ce.error != Callable::CallError::CALL_OK) {
+#ifdef DEBUG_ENABLED
+					if (flags & CONNECT_PERSIST && Engine::get_singleton()->is_editor_hint() && (script.is_null() || !Ref<Script>(script)->is_tool())) {
+						continue;
+					}
+#endif
+					ERR_PRINT(vformat("Error calling from signal '%s' to callable: %s.", String(p_name), Variant::get_callable_error_text(callable, args, argc, ce)));
+					err = ERR_METHOD_NOT_FOUND;
+				}
+				continue;
+			}
+		}
 
 		if (!callable.is_valid()) {
 			// Target might have been deleted during signal callback, this is expected and OK.
 			continue;
 		}
 
-		const Variant **args = p_args;
-		int argc = p_argcount;
-
 		if (flags & CONNECT_DEFERRED) {
 			MessageQueue::get_singleton()->push_callablep(callable, args, argc, true);
 		} else {
@@ -1253,11 +1278,34 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		}
 	}
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		slot_callables[i].~Callable();
+	return err;
+}
+
+void Object::SignalData::update_emit_slots() {
+	Vector<EmitSlot> new_slots;
+	new_slots.resize(slot_map.size());
+	EmitSlot *w = new_slots.ptrw();
+	has_one_shot = false;
+
+	for (const KeyValue<Callable, Slot> &slot_kv : slot_map) {
+		EmitSlot &emit_slot = *w++;
+		emit_slot.callable = slot_kv.value.conn.callable;
+		emit_slot.flags = slot_kv.value.conn.flags;
+		emit_slot.method = nullptr;
+		if (emit_slot.flags & CONNECT_ONE_SHOT) {
+			has_one_shot = true;
+		}
+
+		if (emit_slot.callable.is_standard()) {
+			Object *target = emit_slot.callable.get_object();
+			if (target && emit_slot.callable.get_method() != CoreStringName(free_)) {
+				emit_slot.method = ClassDB::get_method(target->get_class_name(), emit_slot.callable.get_method());
+			}
+		}
 	}
 
-	return err;
+	emit_slots = new_slots;
+	emit_slots_dirty = false;
 }
 
 void Object::_add_user_signal(const String &p_name, const Array &p_args) {
@@ -1470,6 +1518,7 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*p_callable.get_base_comparator()] = slot;
+	s->emit_slots_dirty = true;
 
 	return OK;
 }
@@ -1545,6 +1594,7 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 	}
 
 	s->slot_map.erase(*p_callable.get_base_comparator());
+	s->emit_slots_dirty = true;
 
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
@@ -617,9 +617,22 @@ private:
 			List<Connection>::Element *cE = nullptr;
 		};
 
+		// Connections as seen by emit_signalp(), rebuilt only after the slots change.
+		// Emission keeps a reference to the array, so callbacks can (dis)connect freely.
+		struct EmitSlot {
+			Callable callable;
+			MethodBind *method = nullptr; // Native method of a standard callable, called directly if the target has no script.
+			uint32_t flags = 0;
+		};
+
 		MethodInfo user;
 		HashMap<Callable, Slot, HashableHasher<Callable>> slot_map;
+		Vector<EmitSlot> emit_slots;
+		bool emit_slots_dirty = true;
+		bool has_one_shot = false;
 		bool removable = false;
+
+		void update_emit_slots();
 	};
 
 	HashMap<StringName, SignalData> signal_map;
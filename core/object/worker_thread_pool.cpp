@@ -426,6 +426,75 @@ Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 	return OK;
 }
 
+// Moves a low priority task still waiting for a free low priority thread to the regular queue.
+// Returns false if the task is not waiting that way, e.g., because it's already running.
+bool WorkerThreadPool::raise_task_priority(TaskID p_task_id) {
+	MutexLock task_lock(task_mutex);
+	Task **taskp = tasks.getptr(p_task_id);
+	if (!taskp) {
+		ERR_FAIL_V_MSG(false, "Invalid Task ID"); // Invalid task
+	}
+	Task *task = *taskp;
+
+	if (!task->low_priority || !task->task_elem.in_list()) {
+		return false;
+	}
+
+	for (SelfList<Task> *E = low_priority_task_queue.first(); E; E = E->next()) {
+		if (E->self() == task) {
+			low_priority_task_queue.remove(E);
+			task->low_priority = false;
+			task_queue.add_last(&task->task_elem);
+
+			ThreadData *caller_pool_thread = thread_ids.has(Thread::get_caller_id()) ? &threads[thread_ids[Thread::get_caller_id()]] : nullptr;
+			_notify_threads(caller_pool_thread, 1, 0);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// Removes a task that didn't start yet, so it never runs. Returns false if it can't be cancelled anymore,
+// or someone is waiting for it. The task ID becomes invalid after a successful cancellation.
+bool WorkerThreadPool::cancel_task(TaskID p_task_id) {
+	MutexLock task_lock(task_mutex);
+	Task **taskp = tasks.getptr(p_task_id);
+	if (!taskp) {
+		ERR_FAIL_V_MSG(false, "Invalid Task ID"); // Invalid task
+	}
+	Task *task = *taskp;
+
+	if (task->group || !task->task_elem.in_list() || task->waiting_pool || task->waiting_user) {
+		return false;
+	}
+
+	bool in_low_priority_queue = false;
+	for (SelfList<Task> *E = low_priority_task_queue.first(); E; E = E->next()) {
+		if (E->self() == task) {
+			in_low_priority_queue = true;
+			break;
+		}
+	}
+	task->task_elem.remove_from_list();
+
+	if (task->low_priority && !in_low_priority_queue) {
+		// It was using one of the low priority slots.
+		low_priority_threads_used--;
+		if (_try_promote_low_priority_task()) {
+			ThreadData *caller_pool_thread = thread_ids.has(Thread::get_caller_id()) ? &threads[thread_ids[Thread::get_caller_id()]] : nullptr;
+			_notify_threads(caller_pool_thread, 1, 0);
+		}
+	}
+
+	if (task->template_userdata) {
+		memdelete(task->template_userdata);
+	}
+	tasks.erase(p_task_id);
+	task_allocator.free(task);
+	return true;
+}
+
 void WorkerThreadPool::_lock_unlockable_mutexes() {
 #ifdef THREADS_ENABLED
 	for (uint32_t i = 0; i < MAX_UNLOCKABLE_LOCKS; i++) {
@@ -239,6 +239,8 @@ public:
 
 	bool is_task_completed(TaskID p_task_id) const;
 	Error wait_for_task_completion(TaskID p_task_id);
+	bool raise_task_priority(TaskID p_task_id);
+	bool cancel_task(TaskID p_task_id);
 
 	void yield();
 	void notify_yield_over(TaskID p_task_id);
@@ -34,9 +34,11 @@
 
 #include "core/os/os.h"
 #include "core/string/print_string.h"
+#include "drivers/unix/file_access_unix_async.h"
 
 #include <errno.h>
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -171,6 +173,7 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+	_unmap();
 	fclose(f);
 	f = nullptr;
 
@@ -249,6 +252,41 @@ uint64_t FileAccessUnix::get_position() const {
 	return pos;
 }
 
+const uint8_t *FileAccessUnix::map_buffer(uint64_t p_offset, uint64_t p_length) {
+	ERR_FAIL_NULL_V_MSG(f, nullptr, "File must be opened before use.");
+	if (flags != READ || p_length == 0) {
+		return nullptr; // Files opened for writing may change under the mapping.
+	}
+	ERR_FAIL_COND_V(p_offset + p_length > get_length(), nullptr);
+
+	_unmap();
+
+	// The offset of the mapping must be aligned to pages.
+	static const uint64_t page_size = sysconf(_SC_PAGESIZE);
+	uint64_t aligned_offset = p_offset - (p_offset % page_size);
+	uint64_t size = p_length + (p_offset - aligned_offset);
+	if (size > SIZE_MAX) {
+		return nullptr; // Doesn't fit in the address space.
+	}
+
+	void *region = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileno(f), aligned_offset);
+	if (region == MAP_FAILED) {
+		return nullptr;
+	}
+
+	mapped_region = region;
+	mapped_region_size = size;
+	return (const uint8_t *)region + (p_offset - aligned_offset);
+}
+
+void FileAccessUnix::_unmap() {
+	if (mapped_region) {
+		munmap(mapped_region, mapped_region_size);
+		mapped_region = nullptr;
+		mapped_region_size = 0;
+	}
+}
+
 uint64_t FileAccessUnix::get_length() const {
 	ERR_FAIL_NULL_V_MSG(f, 0, "File must be opened before use.");
 
@@ -266,6 +304,23 @@ bool FileAccessUnix::eof_reached() const {
 	return feof(f);
 }
 
+FileAccess::AsyncReadID FileAccessUnix::read_async(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) {
+	ERR_FAIL_NULL_V_MSG(f, INVALID_ASYNC_READ_ID, "File must be opened before use.");
+	ERR_FAIL_COND_V(!p_dst && p_length > 0, INVALID_ASYNC_READ_ID);
+	if (flags != READ) {
+		fflush(f); // Reads go to the file descriptor, skipping the stream buffer.
+	}
+	return FileAccessUnixAsync::read(fileno(f), p_offset, p_dst, p_length);
+}
+
+bool FileAccessUnix::is_async_read_completed(AsyncReadID p_id) const {
+	return FileAccessUnixAsync::is_completed(p_id);
+}
+
+int64_t FileAccessUnix::wait_for_async_read(AsyncReadID p_id) {
+	return FileAccessUnixAsync::wait(p_id);
+}
+
 uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	ERR_FAIL_NULL_V_MSG(f, -1, "File must be opened before use.");
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
@@ -47,7 +47,11 @@ class FileAccessUnix : public FileAccess {
 	String path;
 	String path_src;
 
+	void *mapped_region = nullptr;
+	size_t mapped_region_size = 0;
+
 	void _close();
+	void _unmap();
 
 #if defined(TOOLS_ENABLED)
 	String get_real_path() const; // Returns the resolved real path for the current open file.
@@ -71,6 +75,11 @@ public:
 	virtual bool eof_reached() const override; ///< reading passed EOF
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *map_buffer(uint64_t p_offset, uint64_t p_length) override;
+
+	virtual AsyncReadID read_async(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) override;
+	virtual bool is_async_read_completed(AsyncReadID p_id) const override;
+	virtual int64_t wait_for_async_read(AsyncReadID p_id) override;
 
 	virtual Error get_error() const override; ///< get last error
 
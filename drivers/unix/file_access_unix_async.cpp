@@ -0,0 +1,387 @@
+/**************************************************************************/
+/*  file_access_unix_async.cpp                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "file_access_unix_async.h"
+
+#if defined(UNIX_ENABLED)
+
+#include "core/object/worker_thread_pool.h"
+#include "core/os/condition_variable.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+// Not on Android, where the seccomp filter of apps kills the process on io_uring system calls.
+#if defined(LINUXBSD_ENABLED) && defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+// Headers older than Linux 5.6 lack IORING_OP_READ, which came with IORING_FEAT_RW_CUR_POS, so reads block there instead.
+#if defined(IORING_FEAT_RW_CUR_POS) && defined(IORING_FEAT_NODROP)
+#define IO_URING_ENABLED
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+#endif
+
+namespace {
+
+// Larger reads are split, the kernel doesn't read more than about 2 GiB at once anyway.
+constexpr uint64_t MAX_READ_CHUNK = 1 << 30;
+
+struct AsyncRead {
+	int fd = -1;
+	uint8_t *dst = nullptr;
+	uint64_t offset = 0;
+	uint64_t length = 0;
+	uint64_t done = 0; // Reads can complete partially, in which case the rest is read again.
+	int64_t result = 0;
+	uint32_t generation = 0;
+	bool used = false;
+	bool completed = false;
+	WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+};
+
+int64_t read_blocking(int p_fd, uint8_t *p_dst, uint64_t p_offset, uint64_t p_length) {
+	uint64_t done = 0;
+	while (done < p_length) {
+		ssize_t ret = pread(p_fd, p_dst + done, MIN(p_length - done, MAX_READ_CHUNK), p_offset + done);
+		if (ret < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return -1;
+		}
+		if (ret == 0) {
+			break; // End of file.
+		}
+		done += ret;
+	}
+	return done;
+}
+
+struct AsyncReads {
+	BinaryMutex mutex;
+	ConditionVariable completed_cond;
+	LocalVector<AsyncRead> reads;
+	LocalVector<uint32_t> free_reads;
+	bool initialized = false;
+
+#ifdef IO_URING_ENABLED
+	static constexpr uint32_t RING_ENTRIES = 64;
+
+	int ring_fd = -1;
+	// While a thread waits in the kernel for completions, it's the only one reaping them, so it can't miss its own.
+	bool waiting = false;
+
+	void *sq_ring = nullptr;
+	size_t sq_ring_size = 0;
+	void *cq_ring = nullptr;
+	size_t cq_ring_size = 0;
+	io_uring_sqe *sqes = nullptr;
+	size_t sqes_size = 0;
+
+	uint32_t *sq_tail = nullptr;
+	uint32_t *sq_mask = nullptr;
+	uint32_t *sq_array = nullptr;
+	uint32_t *cq_head = nullptr;
+	uint32_t *cq_tail = nullptr;
+	uint32_t *cq_mask = nullptr;
+	io_uring_cqe *cqes = nullptr;
+
+	void _close_ring(int p_fd) {
+		if (sqes && sqes != MAP_FAILED) {
+			munmap(sqes, sqes_size);
+		}
+		if (cq_ring && cq_ring != MAP_FAILED && cq_ring != sq_ring) {
+			munmap(cq_ring, cq_ring_size);
+		}
+		if (sq_ring && sq_ring != MAP_FAILED) {
+			munmap(sq_ring, sq_ring_size);
+		}
+		sqes = nullptr;
+		cq_ring = nullptr;
+		sq_ring = nullptr;
+		close(p_fd);
+	}
+
+	void _setup_ring() {
+		io_uring_params params;
+		memset(&params, 0, sizeof(params));
+		int fd = syscall(__NR_io_uring_setup, RING_ENTRIES, &params);
+		if (fd < 0) {
+			return; // Not supported by the kernel, or not allowed.
+		}
+		// IORING_OP_READ came with IORING_FEAT_RW_CUR_POS (Linux 5.6), and NODROP lets more reads be in flight than the
+		// completion queue can hold.
+		if (!(params.features & IORING_FEAT_RW_CUR_POS) || !(params.features & IORING_FEAT_NODROP)) {
+			close(fd);
+			return;
+		}
+
+		sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+		cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+		const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+		if (single_mmap) {
+			sq_ring_size = MAX(sq_ring_size, cq_ring_size);
+		}
+
+		sq_ring = mmap(nullptr, sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+		if (sq_ring == MAP_FAILED) {
+			_close_ring(fd);
+			return;
+		}
+		cq_ring = single_mmap ? sq_ring : mmap(nullptr, cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+		if (cq_ring == MAP_FAILED) {
+			_close_ring(fd);
+			return;
+		}
+		sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+		sqes = (io_uring_sqe *)mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+		if (sqes == MAP_FAILED) {
+			_close_ring(fd);
+			return;
+		}
+
+		uint8_t *sq = (uint8_t *)sq_ring;
+		sq_tail = (uint32_t *)(sq + params.sq_off.tail);
+		sq_mask = (uint32_t *)(sq + params.sq_off.ring_mask);
+		sq_array = (uint32_t *)(sq + params.sq_off.array);
+		uint8_t *cq = (uint8_t *)cq_ring;
+		cq_head = (uint32_t *)(cq + params.cq_off.head);
+		cq_tail = (uint32_t *)(cq + params.cq_off.tail);
+		cq_mask = (uint32_t *)(cq + params.cq_off.ring_mask);
+		cqes = (io_uring_cqe *)(cq + params.cq_off.cqes);
+		ring_fd = fd;
+	}
+
+	void _submit(uint32_t p_index) {
+		AsyncRead &read = reads[p_index];
+
+		// Every entry is submitted right away, so the submission queue never fills up.
+		const uint32_t tail = *sq_tail;
+		const uint32_t sqe_index = tail & *sq_mask;
+		io_uring_sqe *sqe = &sqes[sqe_index];
+		memset(sqe, 0, sizeof(io_uring_sqe));
+		sqe->opcode = IORING_OP_READ;
+		sqe->fd = read.fd;
+		sqe->off = read.offset + read.done;
+		sqe->addr = (uint64_t)(uintptr_t)(read.dst + read.done);
+		sqe->len = MIN(read.length - read.done, MAX_READ_CHUNK);
+		sqe->user_data = p_index;
+		sq_array[sqe_index] = sqe_index;
+		__atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+		int ret;
+		do {
+			ret = syscall(__NR_io_uring_enter, ring_fd, 1, 0, 0, nullptr, 0);
+		} while (ret < 0 && errno == EINTR);
+
+		if (ret != 1) {
+			// Take the entry back and read here instead.
+			__atomic_store_n(sq_tail, tail, __ATOMIC_RELEASE);
+			int64_t rest = read_blocking(read.fd, read.dst + read.done, read.offset + read.done, read.length - read.done);
+			read.result = rest < 0 ? -1 : int64_t(read.done + rest);
+			read.completed = true;
+		}
+	}
+
+	void _reap() {
+		uint32_t head = *cq_head;
+		const uint32_t tail = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+		if (head == tail) {
+			return;
+		}
+
+		while (head != tail) {
+			const io_uring_cqe &cqe = cqes[head & *cq_mask];
+			const uint32_t index = cqe.user_data;
+			const int res = cqe.res;
+			head++;
+
+			AsyncRead &read = reads[index];
+			if (res == -EINTR || res == -EAGAIN) {
+				_submit(index);
+			} else if (res < 0) {
+				read.result = -1;
+				read.completed = true;
+			} else {
+				read.done += res;
+				if (res > 0 && read.done < read.length) {
+					_submit(index);
+				} else {
+					read.result = read.done;
+					read.completed = true;
+				}
+			}
+		}
+		__atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+		completed_cond.notify_all();
+	}
+
+	~AsyncReads() {
+		if (ring_fd >= 0) {
+			_close_ring(ring_fd);
+			ring_fd = -1;
+		}
+	}
+#endif // IO_URING_ENABLED
+
+	static void _read_task(void *p_userdata);
+
+	AsyncRead *_get_read(FileAccess::AsyncReadID p_id) {
+		if (p_id < 0) {
+			return nullptr;
+		}
+		const uint32_t index = p_id & 0xFFFFFFFF;
+		if (index >= reads.size() || !reads[index].used || reads[index].generation != uint32_t(p_id >> 32)) {
+			return nullptr;
+		}
+		return &reads[index];
+	}
+};
+
+AsyncReads async_reads;
+
+void AsyncReads::_read_task(void *p_userdata) {
+	const uint32_t index = (uint32_t)(uintptr_t)p_userdata;
+	AsyncRead read;
+	{
+		MutexLock lock(async_reads.mutex);
+		read = async_reads.reads[index];
+	}
+
+	int64_t result = read_blocking(read.fd, read.dst, read.offset, read.length);
+
+	MutexLock lock(async_reads.mutex);
+	async_reads.reads[index].result = result;
+	async_reads.reads[index].completed = true;
+}
+
+} // namespace
+
+FileAccess::AsyncReadID FileAccessUnixAsync::read(int p_fd, uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) {
+	MutexLock lock(async_reads.mutex);
+	if (!async_reads.initialized) {
+#ifdef IO_URING_ENABLED
+		async_reads._setup_ring();
+#endif
+		async_reads.initialized = true;
+	}
+
+	uint32_t index;
+	if (async_reads.free_reads.size()) {
+		index = async_reads.free_reads[async_reads.free_reads.size() - 1];
+		async_reads.free_reads.resize(async_reads.free_reads.size() - 1);
+	} else {
+		index = async_reads.reads.size();
+		async_reads.reads.push_back(AsyncRead());
+	}
+
+	AsyncRead &read = async_reads.reads[index];
+	read.fd = p_fd;
+	read.dst = p_dst;
+	read.offset = p_offset;
+	read.length = p_length;
+	read.done = 0;
+	read.result = 0;
+	read.used = true;
+	read.completed = p_length == 0;
+	const FileAccess::AsyncReadID id = (FileAccess::AsyncReadID(read.generation) << 32) | index;
+
+	if (read.completed) {
+		return id;
+	}
+#ifdef IO_URING_ENABLED
+	if (async_reads.ring_fd >= 0) {
+		async_reads._submit(index);
+		return id;
+	}
+#endif
+	read.task_id = WorkerThreadPool::get_singleton()->add_native_task(&AsyncReads::_read_task, (void *)(uintptr_t)index, false, "AsyncFileRead");
+	return id;
+}
+
+bool FileAccessUnixAsync::is_completed(FileAccess::AsyncReadID p_id) {
+	MutexLock lock(async_reads.mutex);
+#ifdef IO_URING_ENABLED
+	if (async_reads.ring_fd >= 0 && !async_reads.waiting) {
+		async_reads._reap();
+	}
+#endif
+	const AsyncRead *read = async_reads._get_read(p_id);
+	ERR_FAIL_NULL_V_MSG(read, false, "Invalid or already waited for asynchronous read.");
+	return read->completed;
+}
+
+int64_t FileAccessUnixAsync::wait(FileAccess::AsyncReadID p_id) {
+	MutexLock lock(async_reads.mutex);
+	ERR_FAIL_NULL_V_MSG(async_reads._get_read(p_id), -1, "Invalid or already waited for asynchronous read.");
+	const uint32_t index = p_id & 0xFFFFFFFF;
+
+	if (async_reads.reads[index].task_id != WorkerThreadPool::INVALID_TASK_ID) {
+		const WorkerThreadPool::TaskID task_id = async_reads.reads[index].task_id;
+		lock.temp_unlock();
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+		lock.temp_relock();
+	}
+#ifdef IO_URING_ENABLED
+	while (!async_reads.reads[index].completed) {
+		if (async_reads.waiting) {
+			async_reads.completed_cond.wait(lock);
+			continue;
+		}
+		async_reads._reap();
+		if (async_reads.reads[index].completed) {
+			break;
+		}
+
+		async_reads.waiting = true;
+		lock.temp_unlock();
+		syscall(__NR_io_uring_enter, async_reads.ring_fd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+		lock.temp_relock();
+		async_reads.waiting = false;
+		async_reads._reap();
+		async_reads.completed_cond.notify_all(); // Another thread may have to wait in the kernel now.
+	}
+#endif
+
+	AsyncRead &read = async_reads.reads[index];
+	DEV_ASSERT(read.completed);
+	const int64_t result = read.result;
+	read.used = false;
+	read.generation = (read.generation + 1) & 0x7FFFFFFF;
+	read.task_id = WorkerThreadPool::INVALID_TASK_ID;
+	async_reads.free_reads.push_back(index);
+	return result;
+}
+
+#endif // UNIX_ENABLED
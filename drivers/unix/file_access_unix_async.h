@@ -0,0 +1,49 @@
+/**************************************************************************/
+/*  file_access_unix_async.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef FILE_ACCESS_UNIX_ASYNC_H
+#define FILE_ACCESS_UNIX_ASYNC_H
+
+#include "core/io/file_access.h"
+
+#if defined(UNIX_ENABLED)
+
+// Reads that don't block the calling thread, shared by all FileAccessUnix files. They are submitted to io_uring
+// when the kernel supports it, and otherwise run as low priority WorkerThreadPool tasks.
+class FileAccessUnixAsync {
+public:
+	static FileAccess::AsyncReadID read(int p_fd, uint64_t p_offset, uint8_t *p_dst, uint64_t p_length);
+	static bool is_completed(FileAccess::AsyncReadID p_id);
+	static int64_t wait(FileAccess::AsyncReadID p_id);
+};
+
+#endif // UNIX_ENABLED
+
+#endif // FILE_ACCESS_UNIX_ASYNC_H
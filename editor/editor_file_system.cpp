@@ -38,6 +38,7 @@
 #include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/variant/variant_parser.h"
+#include "core/version.h"
 #include "editor/editor_help.h"
 #include "editor/editor_node.h"
 #include "editor/editor_paths.h"
@@ -2642,6 +2643,107 @@ Error EditorFileSystem::_reimport_group(const String &p_group_file, const Vector
 	return err;
 }
 
+// The import cache stores the files of an import under a hash of everything the importer output depends on,
+// so that other checkouts (or this one, after the .godot folder was removed) can copy them instead of importing again.
+static String _get_import_cache_key(const String &p_file, const Ref<ResourceImporter> &p_importer, const HashMap<StringName, Variant> &p_params, const List<ResourceImporter::ImportOption> &p_options, ResourceUID::ID p_uid, const Variant &p_generator_parameters) {
+	const String source_sha256 = FileAccess::get_sha256(p_file);
+	if (source_sha256.is_empty()) {
+		return String();
+	}
+
+	String key = String(VERSION_FULL_CONFIG) + "\n" + p_file + "\n" + source_sha256 + "\n";
+	key += p_importer->get_importer_name() + "\n" + itos(p_importer->get_format_version()) + "\n" + p_importer->get_import_settings_string() + "\n";
+	key += ResourceUID::get_singleton()->id_to_text(p_uid) + "\n";
+	if (p_generator_parameters != Variant()) {
+		key += p_generator_parameters.get_construct_string() + "\n";
+	}
+	for (const ResourceImporter::ImportOption &E : p_options) {
+		String value;
+		VariantWriter::write_to_string(p_params[E.option.name], value);
+		key += E.option.name + "=" + value + "\n";
+	}
+	return key.sha256_text();
+}
+
+// Suffixes are appended to the base path of the imported file. The cache can be shared, so they can't be trusted to stay in the imported folder.
+static bool _is_import_cache_suffix_valid(const String &p_base_path, const String &p_suffix) {
+	if (p_suffix.contains_char('/') || p_suffix.contains_char('\\') || p_suffix.contains("..")) {
+		return false;
+	}
+	return (p_base_path + p_suffix).simplify_path().get_base_dir() == p_base_path.simplify_path().get_base_dir();
+}
+
+bool EditorFileSystem::_fetch_import_cache(const String &p_entry_dir, const String &p_base_path, List<String> *r_import_variants, Variant *r_meta) {
+	Ref<ConfigFile> cf;
+	cf.instantiate();
+	if (cf->load(p_entry_dir.path_join("entry.cfg")) != OK) {
+		return false;
+	}
+
+	const PackedStringArray files = cf->get_value("entry", "files", PackedStringArray());
+	const PackedStringArray variants = cf->get_value("entry", "variants", PackedStringArray());
+	for (const String &suffix : files) {
+		ERR_FAIL_COND_V_MSG(!_is_import_cache_suffix_valid(p_base_path, suffix), false, vformat("Invalid file in import cache entry \"%s\": \"%s\".", p_entry_dir, suffix));
+	}
+	for (const String &variant : variants) {
+		ERR_FAIL_COND_V_MSG(!_is_import_cache_suffix_valid(p_base_path, "." + variant), false, vformat("Invalid variant in import cache entry \"%s\": \"%s\".", p_entry_dir, variant));
+	}
+
+	for (const String &suffix : files) {
+		if (DirAccess::copy_absolute(p_entry_dir.path_join("data" + suffix), p_base_path + suffix) != OK) {
+			return false;
+		}
+	}
+
+	for (const String &variant : variants) {
+		r_import_variants->push_back(variant);
+	}
+	if (cf->has_section_key("entry", "metadata")) {
+		*r_meta = cf->get_value("entry", "metadata");
+	}
+	return true;
+}
+
+static void _remove_import_cache_dir(const String &p_dir) {
+	Ref<DirAccess> da = DirAccess::open(p_dir);
+	if (da.is_valid()) {
+		da->erase_contents_recursive();
+		DirAccess::remove_absolute(p_dir);
+	}
+}
+
+void EditorFileSystem::_store_import_cache(const String &p_entry_dir, const String &p_base_path, const Vector<String> &p_dest_paths, const List<String> &p_import_variants, const Variant &p_meta) {
+	// Fill a temporary directory and move it in place, so a partial entry is never visible to other editors.
+	const String tmp_dir = p_entry_dir + vformat(".%d-%d.tmp", OS::get_singleton()->get_process_id(), (uint64_t)Thread::get_caller_id());
+	if (DirAccess::make_dir_recursive_absolute(tmp_dir) != OK) {
+		return;
+	}
+
+	PackedStringArray files;
+	for (const String &path : p_dest_paths) {
+		if (!path.begins_with(p_base_path) || DirAccess::copy_absolute(path, tmp_dir.path_join("data" + path.substr(p_base_path.length()))) != OK) {
+			_remove_import_cache_dir(tmp_dir);
+			return;
+		}
+		files.push_back(path.substr(p_base_path.length()));
+	}
+
+	PackedStringArray variants;
+	for (const String &variant : p_import_variants) {
+		variants.push_back(variant);
+	}
+
+	Ref<ConfigFile> cf;
+	cf.instantiate();
+	cf->set_value("entry", "files", files);
+	cf->set_value("entry", "variants", variants);
+	cf->set_value("entry", "metadata", p_meta);
+	if (cf->save(tmp_dir.path_join("entry.cfg")) != OK || DirAccess::rename_absolute(tmp_dir, p_entry_dir) != OK) {
+		// Most likely, the same entry was stored concurrently.
+		_remove_import_cache_dir(tmp_dir);
+	}
+}
+
 Error EditorFileSystem::_reimport_file(const String &p_file, const HashMap<StringName, Variant> &p_custom_options, const String &p_custom_importer, Variant *p_generator_parameters, bool p_update_file_system) {
 	print_verbose(vformat("EditorFileSystem: Importing file: %s", p_file));
 	uint64_t start_time = OS::get_singleton()->get_ticks_msec();
@@ -2769,7 +2871,27 @@ Error EditorFileSystem::_reimport_file(const String &p_file, const HashMap<Strin
 	List<String> import_variants;
 	List<String> gen_files;
 	Variant meta;
-	Error err = importer->import(uid, p_file, base_path, params, &import_variants, &gen_files, &meta);
+	Error err = FAILED;
+
+	String import_cache_entry;
+	const String import_cache_path = EDITOR_GET("filesystem/import/cache_path");
+	if (!import_cache_path.is_empty() && importer->can_cache_import(params)) {
+		const String key = _get_import_cache_key(p_file, importer, params, opts, uid, generator_parameters);
+		if (!key.is_empty()) {
+			import_cache_entry = import_cache_path.path_join(key.substr(0, 2)).path_join(key);
+		}
+	}
+
+	if (!import_cache_entry.is_empty() && _fetch_import_cache(import_cache_entry, base_path, &import_variants, &meta)) {
+		print_verbose(vformat("EditorFileSystem: \"%s\" was copied from the import cache.", p_file));
+		err = OK;
+	} else {
+		err = importer->import(uid, p_file, base_path, params, &import_variants, &gen_files, &meta);
+		if (err != OK || !gen_files.is_empty()) {
+			// Generated files can be anywhere in the project, only the files in the imported folder are cached.
+			import_cache_entry = String();
+		}
+	}
 
 	// As import is complete, save the .import file.
 
@@ -2862,6 +2984,10 @@ Error EditorFileSystem::_reimport_file(const String &p_file, const HashMap<Strin
 		}
 	}
 
+	if (!import_cache_entry.is_empty() && !DirAccess::dir_exists_absolute(import_cache_entry)) {
+		_store_import_cache(import_cache_entry, base_path, dest_paths, import_variants, meta);
+	}
+
 	// Store the md5's of the various files. These are stored separately so that the .import files can be version controlled.
 	{
 		Ref<FileAccess> md5s = FileAccess::open(base_path + ".md5", FileAccess::WRITE);
@@ -3123,20 +3249,30 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 		}
 
 		if (use_multiple_threads && reimport_files[i].threaded) {
-			if (i + 1 == reimport_files.size() || reimport_files[i + 1].importer != reimport_files[from].importer || groups_to_reimport.has(reimport_files[i + 1].path)) {
+			// Files are sorted by import order, then importer. Import all consecutive threaded files with the same
+			// import order together, so that importers with few files don't leave the other threads idle.
+			if (i + 1 == reimport_files.size() || !reimport_files[i + 1].threaded || reimport_files[i + 1].order != reimport_files[from].order || groups_to_reimport.has(reimport_files[i + 1].path)) {
 				if (from - i == 0) {
 					// Single file, do not use threads.
 					ep->step(reimport_files[i].path.get_file(), i, false);
 					_reimport_file(reimport_files[i].path);
 				} else {
-					Ref<ResourceImporter> importer = ResourceFormatImporter::get_singleton()->get_importer_by_name(reimport_files[from].importer);
-					if (importer.is_null()) {
-						ERR_PRINT(vformat("Invalid importer for \"%s\".", reimport_files[from].importer));
-						from = i + 1;
-						continue;
+					LocalVector<Ref<ResourceImporter>> importers;
+					for (int j = from; j <= i; j++) {
+						if (j > from && reimport_files[j].importer == reimport_files[j - 1].importer) {
+							continue;
+						}
+						Ref<ResourceImporter> importer = ResourceFormatImporter::get_singleton()->get_importer_by_name(reimport_files[j].importer);
+						if (importer.is_null()) {
+							ERR_PRINT(vformat("Invalid importer for \"%s\".", reimport_files[j].importer));
+							continue;
+						}
+						importers.push_back(importer);
 					}
 
-					importer->import_threaded_begin();
+					for (const Ref<ResourceImporter> &importer : importers) {
+						importer->import_threaded_begin();
+					}
 
 					ImportThreadData tdata;
 					tdata.reimport_from = from;
@@ -3144,11 +3280,11 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 					tdata.imported_sem = &imported_sem;
 
 					int item_count = i - from + 1;
-					WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_reimport_thread, &tdata, item_count, -1, false, vformat(TTR("Import resources of type: %s"), reimport_files[from].importer));
+					WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_reimport_thread, &tdata, item_count, -1, false, TTR("Import resources"));
 
 					int imported_count = 0;
 					while (true) {
-						ep->step(reimport_files[imported_count].path.get_file(), from + imported_count, false);
+						ep->step(reimport_files[from + imported_count].path.get_file(), from + imported_count, false);
 						imported_sem.wait();
 						do {
 							imported_count++;
@@ -3161,7 +3297,9 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 					DEV_ASSERT(!imported_sem.try_wait());
 
-					importer->import_threaded_end();
+					for (const Ref<ResourceImporter> &importer : importers) {
+						importer->import_threaded_end();
+					}
 				}
 
 				from = i + 1;
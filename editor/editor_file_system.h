@@ -412,6 +412,9 @@ public:
 
 	static bool _should_skip_directory(const String &p_path);
 
+	static bool _fetch_import_cache(const String &p_entry_dir, const String &p_base_path, List<String> *r_import_variants, Variant *r_meta);
+	static void _store_import_cache(const String &p_entry_dir, const String &p_base_path, const Vector<String> &p_dest_paths, const List<String> &p_import_variants, const Variant &p_meta);
+
 	void add_import_format_support_query(Ref<EditorFileSystemImportFormatSupportQuery> p_query);
 	void remove_import_format_support_query(Ref<EditorFileSystemImportFormatSupportQuery> p_query);
 	EditorFileSystem();
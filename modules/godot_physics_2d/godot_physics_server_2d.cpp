@@ -36,6 +36,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/debugger/engine_debugger.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 
 #define FLUSH_QUERY_CHECK(m_object) \
@@ -1002,6 +1003,62 @@ bool GodotPhysicsServer2D::body_test_motion(RID p_body, const MotionParameters &
 	return body->get_space()->test_body_motion(body, p_parameters, r_result);
 }
 
+void GodotPhysicsServer2D::_test_motion_batch_chunk(uint32_t p_chunk_index, MotionBatch *p_batch) {
+	// Each chunk uses its own query buffers, so chunks can be tested in parallel.
+	LocalVector<GodotCollisionObject2D *> query_results;
+	LocalVector<int> query_subindex_results;
+	query_results.resize(GodotSpace2D::INTERSECTION_QUERY_MAX);
+	query_subindex_results.resize(GodotSpace2D::INTERSECTION_QUERY_MAX);
+
+	const int begin = p_chunk_index * p_batch->count / p_batch->chunk_count;
+	const int end = (p_chunk_index + 1) * p_batch->count / p_batch->chunk_count;
+	for (int i = begin; i < end; i++) {
+		GodotBody2D *body = p_batch->bodies[i];
+		bool collided = false;
+		if (body) {
+			MotionResult *result = p_batch->results ? &p_batch->results[i] : nullptr;
+			collided = body->get_space()->test_body_motion(body, p_batch->parameters[i], result, query_results.ptr(), query_subindex_results.ptr());
+		}
+		if (p_batch->collided) {
+			p_batch->collided[i] = collided;
+		}
+	}
+}
+
+void GodotPhysicsServer2D::body_test_motion_batch(const RID *p_bodies, const MotionParameters *p_parameters, MotionResult *r_results, bool *r_collided, int p_count) {
+	ERR_FAIL_COND(p_count < 0);
+
+	_update_shapes();
+
+	LocalVector<GodotBody2D *> bodies;
+	bodies.resize(p_count);
+	for (int i = 0; i < p_count; i++) {
+		bodies[i] = nullptr;
+		GodotBody2D *body = body_owner.get_or_null(p_bodies[i]);
+		ERR_CONTINUE(!body);
+		ERR_CONTINUE(!body->get_space());
+		ERR_CONTINUE(body->get_space()->is_locked());
+		bodies[i] = body;
+	}
+
+	MotionBatch batch;
+	batch.bodies = bodies.ptr();
+	batch.parameters = p_parameters;
+	batch.results = r_results;
+	batch.collided = r_collided;
+	batch.count = p_count;
+	batch.chunk_count = MIN(p_count, WorkerThreadPool::get_singleton()->get_thread_count());
+
+	if (batch.chunk_count <= 1) {
+		batch.chunk_count = 1;
+		_test_motion_batch_chunk(0, &batch);
+		return;
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotPhysicsServer2D::_test_motion_batch_chunk, &batch, batch.chunk_count, -1, true, SNAME("Physics2DTestMotionBatch"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
 PhysicsDirectBodyState2D *GodotPhysicsServer2D::body_get_direct_state(RID p_body) {
 	ERR_FAIL_COND_V_MSG((using_threads && !doing_sync), nullptr, "Body state is inaccessible right now, wait for iteration or physics process notification.");
 
@@ -70,6 +70,17 @@ class GodotPhysicsServer2D : public PhysicsServer2D {
 	SelfList<GodotCollisionObject2D>::List pending_shape_update_list;
 	void _update_shapes();
 
+	struct MotionBatch {
+		GodotBody2D *const *bodies = nullptr;
+		const MotionParameters *parameters = nullptr;
+		MotionResult *results = nullptr;
+		bool *collided = nullptr;
+		int count = 0;
+		int chunk_count = 0;
+	};
+
+	void _test_motion_batch_chunk(uint32_t p_chunk_index, MotionBatch *p_batch);
+
 	RID _shape_create(ShapeType p_shape);
 
 public:
@@ -255,6 +266,7 @@ public:
 	virtual void body_set_pickable(RID p_body, bool p_pickable) override;
 
 	virtual bool body_test_motion(RID p_body, const MotionParameters &p_parameters, MotionResult *r_result = nullptr) override;
+	virtual void body_test_motion_batch(const RID *p_bodies, const MotionParameters *p_parameters, MotionResult *r_results, bool *r_collided, int p_count) override;
 
 	// this function only works on physics process, errors and returns null otherwise
 	virtual PhysicsDirectBodyState2D *body_get_direct_state(RID p_body) override;
@@ -503,26 +503,26 @@ bool GodotPhysicsDirectSpaceState2D::rest_info(const ShapeParameters &p_paramete
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-int GodotSpace2D::_cull_aabb_for_body(GodotBody2D *p_body, const Rect2 &p_aabb) {
-	int amount = broadphase->cull_aabb(p_aabb, intersection_query_results, INTERSECTION_QUERY_MAX, intersection_query_subindex_results);
+int GodotSpace2D::_cull_aabb_for_body(GodotBody2D *p_body, const Rect2 &p_aabb, GodotCollisionObject2D **r_results, int *r_subindex_results) {
+	int amount = broadphase->cull_aabb(p_aabb, r_results, INTERSECTION_QUERY_MAX, r_subindex_results);
 
 	for (int i = 0; i < amount; i++) {
 		bool keep = true;
 
-		if (intersection_query_results[i] == p_body) {
+		if (r_results[i] == p_body) {
 			keep = false;
-		} else if (intersection_query_results[i]->get_type() == GodotCollisionObject2D::TYPE_AREA) {
+		} else if (r_results[i]->get_type() == GodotCollisionObject2D::TYPE_AREA) {
 			keep = false;
-		} else if (!p_body->collides_with(static_cast<GodotBody2D *>(intersection_query_results[i]))) {
+		} else if (!p_body->collides_with(static_cast<GodotBody2D *>(r_results[i]))) {
 			keep = false;
-		} else if (static_cast<GodotBody2D *>(intersection_query_results[i])->has_exception(p_body->get_self()) || p_body->has_exception(intersection_query_results[i]->get_self())) {
+		} else if (static_cast<GodotBody2D *>(r_results[i])->has_exception(p_body->get_self()) || p_body->has_exception(r_results[i]->get_self())) {
 			keep = false;
 		}
 
 		if (!keep) {
 			if (i < amount - 1) {
-				SWAP(intersection_query_results[i], intersection_query_results[amount - 1]);
-				SWAP(intersection_query_subindex_results[i], intersection_query_subindex_results[amount - 1]);
+				SWAP(r_results[i], r_results[amount - 1]);
+				SWAP(r_subindex_results[i], r_subindex_results[amount - 1]);
 			}
 
 			amount--;
@@ -533,7 +533,7 @@ int GodotSpace2D::_cull_aabb_for_body(GodotBody2D *p_body, const Rect2 &p_aabb)
 	return amount;
 }
 
-bool GodotSpace2D::test_body_motion(GodotBody2D *p_body, const PhysicsServer2D::MotionParameters &p_parameters, PhysicsServer2D::MotionResult *r_result) {
+bool GodotSpace2D::test_body_motion(GodotBody2D *p_body, const PhysicsServer2D::MotionParameters &p_parameters, PhysicsServer2D::MotionResult *r_result, GodotCollisionObject2D **r_query_results, int *r_query_subindex_results) {
 	//give me back regular physics engine logic
 	//this is madness
 	//and most people using this function will think
@@ -613,7 +613,7 @@ bool GodotSpace2D::test_body_motion(GodotBody2D *p_body, const PhysicsServer2D::
 
 			bool collided = false;
 
-			int amount = _cull_aabb_for_body(p_body, body_aabb);
+			int amount = _cull_aabb_for_body(p_body, body_aabb, r_query_results, r_query_subindex_results);
 
 			for (int j = 0; j < p_body->get_shape_count(); j++) {
 				if (p_body->is_shape_disabled(j)) {
@@ -624,7 +624,7 @@ bool GodotSpace2D::test_body_motion(GodotBody2D *p_body, const PhysicsServer2D::
 				Transform2D body_shape_xform = body_transform * p_body->get_shape_transform(j);
 
 				for (int i = 0; i < amount; i++) {
-					const GodotCollisionObject2D *col_obj = intersection_query_results[i];
+					const GodotCollisionObject2D *col_obj = r_query_results[i];
 					if (p_parameters.exclude_bodies.has(col_obj->get_self())) {
 						continue;
 					}
@@ -632,7 +632,7 @@ bool GodotSpace2D::test_body_motion(GodotBody2D *p_body, const PhysicsServer2D::
 						continue;
 					}
 
-					int shape_idx = intersection_query_subindex_results[i];
+					int shape_idx = r_query_subindex_results[i];
 
 					Transform2D col_obj_shape_xform = col_obj->get_transform() * col_obj->get_shape_transform(shape_idx);
 
@@ -743,7 +743,7 @@ bool GodotSpace2D::test_body_motion(GodotBody2D *p_body, const PhysicsServer2D::
 		motion_aabb.position += p_parameters.motion;
 		motion_aabb = motion_aabb.merge(body_aabb);
 
-		int amount = _cull_aabb_for_body(p_body, motion_aabb);
+		int amount = _cull_aabb_for_body(p_body, motion_aabb, r_query_results, r_query_subindex_results);
 
 		for (int body_shape_idx = 0; body_shape_idx < p_body->get_shape_count(); body_shape_idx++) {
 			if (p_body->is_shape_disabled(body_shape_idx)) {
@@ -769,7 +769,7 @@ bool GodotSpace2D::test_body_motion(GodotBody2D *p_body, const PhysicsServer2D::
 			real_t best_unsafe = 1;
 
 			for (int i = 0; i < amount; i++) {
-				const GodotCollisionObject2D *col_obj = intersection_query_results[i];
+				const GodotCollisionObject2D *col_obj = r_query_results[i];
 				if (p_parameters.exclude_bodies.has(col_obj->get_self())) {
 					continue;
 				}
@@ -777,7 +777,7 @@ bool GodotSpace2D::test_body_motion(GodotBody2D *p_body, const PhysicsServer2D::
 					continue;
 				}
 
-				int col_shape_idx = intersection_query_subindex_results[i];
+				int col_shape_idx = r_query_subindex_results[i];
 				GodotShape2D *against_shape = col_obj->get_shape(col_shape_idx);
 
 				bool excluded = false;
@@ -903,7 +903,7 @@ bool GodotSpace2D::test_body_motion(GodotBody2D *p_body, const PhysicsServer2D::
 		rcd.min_allowed_depth = MIN(motion_length, min_contact_depth);
 
 		body_aabb.position += p_parameters.motion * unsafe;
-		int amount = _cull_aabb_for_body(p_body, body_aabb);
+		int amount = _cull_aabb_for_body(p_body, body_aabb, r_query_results, r_query_subindex_results);
 
 		int from_shape = best_shape != -1 ? best_shape : 0;
 		int to_shape = best_shape != -1 ? best_shape + 1 : p_body->get_shape_count();
@@ -917,7 +917,7 @@ bool GodotSpace2D::test_body_motion(GodotBody2D *p_body, const PhysicsServer2D::
 			GodotShape2D *body_shape = p_body->get_shape(j);
 
 			for (int i = 0; i < amount; i++) {
-				const GodotCollisionObject2D *col_obj = intersection_query_results[i];
+				const GodotCollisionObject2D *col_obj = r_query_results[i];
 				if (p_parameters.exclude_bodies.has(col_obj->get_self())) {
 					continue;
 				}
@@ -925,7 +925,7 @@ bool GodotSpace2D::test_body_motion(GodotBody2D *p_body, const PhysicsServer2D::
 					continue;
 				}
 
-				int shape_idx = intersection_query_subindex_results[i];
+				int shape_idx = r_query_subindex_results[i];
 
 				GodotShape2D *against_shape = col_obj->get_shape(shape_idx);
 
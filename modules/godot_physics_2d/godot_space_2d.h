@@ -66,6 +66,10 @@ public:
 
 	};
 
+	enum {
+		INTERSECTION_QUERY_MAX = 2048
+	};
+
 private:
 	struct ExcludedShapeSW {
 		GodotShape2D *local_shape = nullptr;
@@ -100,10 +104,6 @@ private:
 	real_t contact_bias = 0.0;
 	real_t constraint_bias = 0.0;
 
-	enum {
-		INTERSECTION_QUERY_MAX = 2048
-	};
-
 	GodotCollisionObject2D *intersection_query_results[INTERSECTION_QUERY_MAX];
 	int intersection_query_subindex_results[INTERSECTION_QUERY_MAX];
 
@@ -119,7 +119,7 @@ private:
 	int active_objects = 0;
 	int collision_pairs = 0;
 
-	int _cull_aabb_for_body(GodotBody2D *p_body, const Rect2 &p_aabb);
+	int _cull_aabb_for_body(GodotBody2D *p_body, const Rect2 &p_aabb, GodotCollisionObject2D **r_results, int *r_subindex_results);
 
 	Vector<Vector2> contact_debug;
 	int contact_debug_count = 0;
@@ -186,7 +186,12 @@ public:
 
 	int get_collision_pairs() const { return collision_pairs; }
 
-	bool test_body_motion(GodotBody2D *p_body, const PhysicsServer2D::MotionParameters &p_parameters, PhysicsServer2D::MotionResult *r_result);
+	_FORCE_INLINE_ bool test_body_motion(GodotBody2D *p_body, const PhysicsServer2D::MotionParameters &p_parameters, PhysicsServer2D::MotionResult *r_result) {
+		return test_body_motion(p_body, p_parameters, r_result, intersection_query_results, intersection_query_subindex_results);
+	}
+	// Doesn't modify the space, so it can be called from multiple threads as long as
+	// each one provides its own query buffers (of INTERSECTION_QUERY_MAX elements).
+	bool test_body_motion(GodotBody2D *p_body, const PhysicsServer2D::MotionParameters &p_parameters, PhysicsServer2D::MotionResult *r_result, GodotCollisionObject2D **r_query_results, int *r_query_subindex_results);
 
 	void set_debug_contacts(int p_amount) { contact_debug.resize(p_amount); }
 	_FORCE_INLINE_ bool is_debugging_contacts() const { return !contact_debug.is_empty(); }
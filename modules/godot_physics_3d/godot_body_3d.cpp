@@ -190,6 +190,27 @@ void GodotBody3D::set_active(bool p_active) {
 	}
 }
 
+void GodotBody3D::restore_state(const Transform3D &p_transform, const Vector3 &p_linear_velocity, const Vector3 &p_angular_velocity, real_t p_still_time, bool p_active) {
+	// Unlike set_state(), this doesn't treat the new transform as a motion,
+	// the body is put back exactly where it was when the state was saved.
+	new_transform = p_transform;
+	_set_transform(p_transform);
+	_set_inv_transform(p_transform.affine_inverse());
+	if (mode >= PhysicsServer3D::BODY_MODE_RIGID) {
+		_update_transform_dependent();
+	}
+
+	linear_velocity = p_linear_velocity;
+	angular_velocity = p_angular_velocity;
+	biased_linear_velocity = Vector3();
+	biased_angular_velocity = Vector3();
+	still_time = p_still_time;
+
+	if (mode != PhysicsServer3D::BODY_MODE_STATIC) {
+		set_active(p_active);
+	}
+}
+
 void GodotBody3D::set_param(PhysicsServer3D::BodyParameter p_param, const Variant &p_value) {
 	switch (p_param) {
 		case PhysicsServer3D::BODY_PARAM_BOUNCE: {
@@ -283,6 +283,9 @@ public:
 	void set_active(bool p_active);
 	_FORCE_INLINE_ bool is_active() const { return active; }
 
+	_FORCE_INLINE_ real_t get_still_time() const { return still_time; }
+	void restore_state(const Transform3D &p_transform, const Vector3 &p_linear_velocity, const Vector3 &p_angular_velocity, real_t p_still_time, bool p_active);
+
 	_FORCE_INLINE_ void wakeup() {
 		if ((!get_space()) || mode == PhysicsServer3D::BODY_MODE_STATIC || mode == PhysicsServer3D::BODY_MODE_KINEMATIC) {
 			return;
@@ -163,13 +163,20 @@ void GodotBodyPair3D::validate_contacts() {
 // that next frame it will be at an appropriate location to collide (i.e. slight overlap).
 // WARNING: The way velocity is adjusted down to cause a collision means the momentum will be
 // weaker than it should for a bounce!
-// Process: Only proceed if body A's motion is high relative to its size.
-// Cast forward along motion vector to see if A is going to enter/pass B's collider next frame, only proceed if it does.
-// Adjust the velocity of A down so that it will just slightly intersect the collider instead of blowing right past it.
+// Process: Only proceed if body A's motion relative to B is high compared to its size.
+// Sweep A's shape along the motion vector to see if it's going to touch B's collider next frame, only proceed if it does.
+// Find the time of impact by bisection, then adjust the velocity of A down so that it will just slightly intersect
+// the collider instead of blowing right past it.
 bool GodotBodyPair3D::_test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B) {
 	GodotShape3D *shape_A_ptr = p_A->get_shape(p_shape_A);
+	GodotShape3D *shape_B_ptr = p_B->get_shape(p_shape_B);
 
-	Vector3 motion = p_A->get_linear_velocity() * p_step;
+	if (shape_A_ptr->is_concave()) {
+		return false; // Can't sweep concave shapes.
+	}
+
+	// Roughly predict the motion of A relative to B in the next frame (ignoring collisions).
+	Vector3 motion = (p_A->get_linear_velocity() - p_B->get_linear_velocity()) * p_step;
 	real_t mlen = motion.length();
 	if (mlen < CMP_EPSILON) {
 		return false;
@@ -180,7 +187,7 @@ bool GodotBodyPair3D::_test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A,
 	real_t min = 0.0, max = 0.0;
 	shape_A_ptr->project_range(mnormal, p_xform_A, min, max);
 
-	// Did it move enough in this direction to even attempt raycast?
+	// Did it move enough in this direction to even attempt a sweep?
 	// Let's say it should move more than 1/3 the size of the object in that axis.
 	bool fast_object = mlen > (max - min) * 0.3;
 	if (!fast_object) {
@@ -188,64 +195,52 @@ bool GodotBodyPair3D::_test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A,
 	}
 
 	// A is moving fast enough that tunneling might occur. See if it's really about to collide.
-
-	// Roughly predict body B's position in the next frame (ignoring collisions).
-	Transform3D predicted_xform_B = p_xform_B.translated(p_B->get_linear_velocity() * p_step);
-
-	// Support points are the farthest forward points on A in the direction of the motion vector.
-	// i.e. the candidate points of which one should hit B first if any collision does occur.
-	static const int max_supports = 16;
-	Vector3 supports_A[max_supports];
-	int support_count_A;
-	GodotShape3D::FeatureType support_type_A;
-	// Convert mnormal into body A's local xform because get_supports requires (and returns) local coordinates.
-	shape_A_ptr->get_supports(p_xform_A.basis.xform_inv(mnormal).normalized(), max_supports, supports_A, support_count_A, support_type_A);
-
-	// Cast a segment from each support point of A in the motion direction.
-	int segment_support_idx = -1;
-	float segment_hit_length = FLT_MAX;
-	Vector3 segment_hit_local;
-	for (int i = 0; i < support_count_A; i++) {
-		supports_A[i] = p_xform_A.xform(supports_A[i]);
-
-		Vector3 from = supports_A[i];
-		Vector3 to = from + motion;
-
-		Transform3D from_inv = predicted_xform_B.affine_inverse();
-
-		// Back up 10% of the per-frame motion behind the support point and use that as the beginning of our cast.
-		// At high speeds, this may mean we're actually casting from well behind the body instead of inside it, which is odd.
-		// But it still works out.
-		Vector3 local_from = from_inv.xform(from - motion * 0.1);
-		Vector3 local_to = from_inv.xform(to);
-
-		Vector3 rpos, rnorm;
-		int fi = -1;
-		if (p_B->get_shape(p_shape_B)->intersect_segment(local_from, local_to, rpos, rnorm, fi, true)) {
-			float hit_length = local_from.distance_to(rpos);
-			if (hit_length < segment_hit_length) {
-				segment_support_idx = i;
-				segment_hit_length = hit_length;
-				segment_hit_local = rpos;
-			}
-		}
-	}
-
-	if (segment_support_idx == -1) {
-		// There was no hit. Since the segment is the length of per-frame motion, this means the bodies will not
+	// Unlike casting rays from the support points, sweeping the whole shape also catches
+	// glancing hits on edges and thin geometry.
+	const Basis xform_inv_A = p_xform_A.affine_inverse().basis;
+	GodotMotionShape3D mshape;
+	mshape.shape = shape_A_ptr;
+	mshape.motion = xform_inv_A.xform(motion);
+
+	AABB sweep_aabb = p_xform_A.xform(shape_A_ptr->get_aabb());
+	sweep_aabb = sweep_aabb.merge(AABB(sweep_aabb.position + motion, sweep_aabb.size));
+
+	Vector3 point_A, point_B;
+	Vector3 sep_axis = mnormal;
+	if (GodotCollisionSolver3D::solve_distance(&mshape, p_xform_A, shape_B_ptr, p_xform_B, point_A, point_B, sweep_aabb, &sep_axis)) {
+		// There was no hit. Since the sweep is the length of per-frame motion, this means the bodies will not
 		// actually collide yet on next frame. We'll probably check again next frame once they're closer.
 		return false;
 	}
 
-	Vector3 hitpos = predicted_xform_B.xform(segment_hit_local);
+	sep_axis = mnormal;
+	if (!GodotCollisionSolver3D::solve_distance(shape_A_ptr, p_xform_A, shape_B_ptr, p_xform_B, point_A, point_B, sweep_aabb, &sep_axis)) {
+		return false; // Already touching, the regular solver takes care of it.
+	}
+
+	// Conservative advancement: find the last fraction of the motion where the shapes are still separated.
+	real_t low = 0.0;
+	real_t hi = 1.0;
+	for (int i = 0; i < 8; i++) {
+		real_t fraction = (low + hi) * 0.5;
+
+		mshape.motion = xform_inv_A.xform(motion * fraction);
+
+		Vector3 lA, lB;
+		Vector3 sep = mnormal;
+		if (GodotCollisionSolver3D::solve_distance(&mshape, p_xform_A, shape_B_ptr, p_xform_B, lA, lB, sweep_aabb, &sep)) {
+			low = fraction;
+		} else {
+			hi = fraction;
+		}
+	}
 
-	real_t newlen = hitpos.distance_to(supports_A[segment_support_idx]);
-	// Adding 1% of body length to the distance between collision and support point
-	// should cause body A's support point to arrive just within B's collider next frame.
+	real_t newlen = mlen * hi;
+	// Adding 1% of body length to the distance travelled until the time of impact
+	// should cause body A to arrive just within B's collider next frame.
 	newlen += (max - min) * 0.01;
-	// FIXME: This doesn't always work well when colliding with a triangle face of a trimesh shape.
 
-	p_A->set_linear_velocity((mnormal * newlen) / p_step);
+	p_A->set_linear_velocity(p_B->get_linear_velocity() + (mnormal * newlen) / p_step);
 
 	return true;
 }
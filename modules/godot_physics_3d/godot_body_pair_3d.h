@@ -104,7 +104,11 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	void validate_contacts();
 	bool _test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B);
 
+	friend class GodotSpace3D; // Saves and restores the contact cache in space snapshots.
+
 public:
+	virtual bool is_body_pair() const override { return true; }
+
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
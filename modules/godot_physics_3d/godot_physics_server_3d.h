@@ -68,6 +68,17 @@ class GodotPhysicsServer3D : public PhysicsServer3D {
 	SelfList<GodotCollisionObject3D>::List pending_shape_update_list;
 	void _update_shapes();
 
+	struct MotionBatch {
+		GodotBody3D *const *bodies = nullptr;
+		const MotionParameters *parameters = nullptr;
+		MotionResult *results = nullptr;
+		bool *collided = nullptr;
+		int count = 0;
+		int chunk_count = 0;
+	};
+
+	void _test_motion_batch_chunk(uint32_t p_chunk_index, MotionBatch *p_batch);
+
 	static GodotPhysicsServer3D *godot_singleton;
 
 public:
@@ -117,6 +128,9 @@ public:
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const override;
 	virtual int space_get_contact_count(RID p_space) const override;
 
+	virtual Vector<uint8_t> space_save_state(RID p_space) const override;
+	virtual Error space_restore_state(RID p_space, const Vector<uint8_t> &p_state) override;
+
 	/* AREA API */
 
 	virtual RID area_create() override;
@@ -251,6 +265,7 @@ public:
 	virtual void body_set_ray_pickable(RID p_body, bool p_enable) override;
 
 	virtual bool body_test_motion(RID p_body, const MotionParameters &p_parameters, MotionResult *r_result = nullptr) override;
+	virtual void body_test_motion_batch(const RID *p_bodies, const MotionParameters *p_parameters, MotionResult *r_results, bool *r_collided, int p_count) override;
 
 	// this function only works on physics process, errors and returns null otherwise
 	virtual PhysicsDirectBodyState3D *body_get_direct_state(RID p_body) override;
@@ -33,6 +33,7 @@
 #include "core/io/image.h"
 #include "core/math/convex_hull.h"
 #include "core/math/geometry_3d.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/sort_array.h"
 
 // GodotHeightMapShape3D is based on Bullet btHeightfieldTerrainShape.
@@ -1610,9 +1611,103 @@ void GodotConcavePolygonShape3D::_fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_a
 	memdelete(p_bvh_tree);
 }
 
-void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_backface_collision) {
+// Prebuilt BVHs are stored with native endianness and precision, and are only
+// used when they were built for the exact same faces.
+#define CONCAVE_BVH_MAGIC 0x48564247 // "GBVH"
+#define CONCAVE_BVH_VERSION 1
+
+struct ConcaveBVHHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t real_size;
+	uint32_t face_count;
+	uint32_t node_count;
+	uint32_t faces_hash;
+};
+
+static uint32_t _concave_faces_hash(const Vector<Vector3> &p_faces) {
+	return hash_murmur3_buffer(p_faces.ptr(), p_faces.size() * sizeof(Vector3));
+}
+
+bool GodotConcavePolygonShape3D::_load_bvh(const Vector<uint8_t> &p_bvh_data, const Vector<Vector3> &p_faces) {
+	if (p_bvh_data.size() < (int)sizeof(ConcaveBVHHeader)) {
+		return false;
+	}
+
+	ConcaveBVHHeader header;
+	memcpy(&header, p_bvh_data.ptr(), sizeof(ConcaveBVHHeader));
+
+	const int face_count = p_faces.size() / 3;
+	if (header.magic != CONCAVE_BVH_MAGIC || header.version != CONCAVE_BVH_VERSION || header.real_size != sizeof(real_t)) {
+		return false;
+	}
+	if (header.face_count != (uint32_t)face_count || header.node_count == 0 || header.node_count > (uint32_t)face_count * 2) {
+		return false;
+	}
+	if ((uint64_t)p_bvh_data.size() != sizeof(ConcaveBVHHeader) + (uint64_t)header.node_count * sizeof(BVH)) {
+		return false;
+	}
+	if (header.faces_hash != _concave_faces_hash(p_faces)) {
+		return false;
+	}
+
+	bvh.resize(header.node_count);
+	memcpy(bvh.ptrw(), p_bvh_data.ptr() + sizeof(ConcaveBVHHeader), header.node_count * sizeof(BVH));
+
+	// Make sure traversal can't go out of bounds or loop, nodes are always stored after their parent.
+	const int node_count = header.node_count;
+	const BVH *nodes = bvh.ptr();
+	for (int i = 0; i < node_count; i++) {
+		const BVH &node = nodes[i];
+		bool valid;
+		if (node.face_index >= 0) {
+			valid = node.face_index < face_count;
+		} else {
+			valid = node.left > i && node.left < node_count && node.right > i && node.right < node_count;
+		}
+		if (!valid) {
+			bvh.clear();
+			return false;
+		}
+	}
+
+	return true;
+}
+
+Vector<uint8_t> GodotConcavePolygonShape3D::_save_bvh() const {
+	Vector<uint8_t> data;
+	if (bvh.is_empty()) {
+		return data;
+	}
+
+	ConcaveBVHHeader header;
+	memset(&header, 0, sizeof(header));
+	header.magic = CONCAVE_BVH_MAGIC;
+	header.version = CONCAVE_BVH_VERSION;
+	header.real_size = sizeof(real_t);
+	header.face_count = faces.size();
+	header.node_count = bvh.size();
+	header.faces_hash = _concave_faces_hash(vertices); // Vertices are stored in the same order as the source faces.
+
+	data.resize(sizeof(ConcaveBVHHeader) + bvh.size() * sizeof(BVH));
+	memcpy(data.ptrw(), &header, sizeof(ConcaveBVHHeader));
+	memcpy(data.ptrw() + sizeof(ConcaveBVHHeader), bvh.ptr(), bvh.size() * sizeof(BVH));
+	return data;
+}
+
+void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_backface_collision, const Vector<uint8_t> &p_bvh_data) {
+	if (!faces.is_empty() && p_faces.size() == vertices.size() && memcmp(p_faces.ptr(), vertices.ptr(), vertices.size() * sizeof(Vector3)) == 0) {
+		// Same geometry, e.g. only backface collision was changed.
+		backface_collision = p_backface_collision;
+		return;
+	}
+
 	int src_face_count = p_faces.size();
 	if (src_face_count == 0) {
+		faces.clear();
+		vertices.clear();
+		bvh.clear();
+		bvh_data.clear();
 		configure(AABB());
 		return;
 	}
@@ -1621,8 +1716,13 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 
 	const Vector3 *facesr = p_faces.ptr();
 
+	// Building the tree is by far the most expensive part of the setup, skip it when a valid prebuilt one is given.
+	const bool bvh_loaded = !p_bvh_data.is_empty() && _load_bvh(p_bvh_data, p_faces);
+
 	Vector<_Volume_BVH_Element> bvh_array;
-	bvh_array.resize(src_face_count);
+	if (!bvh_loaded) {
+		bvh_array.resize(src_face_count);
+	}
 
 	_Volume_BVH_Element *bvh_arrayw = bvh_array.ptrw();
 
@@ -1637,10 +1737,13 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 
 	for (int i = 0; i < src_face_count; i++) {
 		Face3 face(facesr[i * 3 + 0], facesr[i * 3 + 1], facesr[i * 3 + 2]);
+		AABB face_aabb = face.get_aabb();
 
-		bvh_arrayw[i].aabb = face.get_aabb();
-		bvh_arrayw[i].center = bvh_arrayw[i].aabb.get_center();
-		bvh_arrayw[i].face_index = i;
+		if (!bvh_loaded) {
+			bvh_arrayw[i].aabb = face_aabb;
+			bvh_arrayw[i].center = face_aabb.get_center();
+			bvh_arrayw[i].face_index = i;
+		}
 		facesw[i].indices[0] = i * 3 + 0;
 		facesw[i].indices[1] = i * 3 + 1;
 		facesw[i].indices[2] = i * 3 + 2;
@@ -1649,21 +1752,30 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 		verticesw[i * 3 + 1] = face.vertex[1];
 		verticesw[i * 3 + 2] = face.vertex[2];
 		if (i == 0) {
-			_aabb = bvh_arrayw[i].aabb;
+			_aabb = face_aabb;
 		} else {
-			_aabb.merge_with(bvh_arrayw[i].aabb);
+			_aabb.merge_with(face_aabb);
 		}
 	}
 
-	int count = 0;
-	_Volume_BVH *bvh_tree = _volume_build_bvh(bvh_arrayw, src_face_count, count);
+	if (!bvh_loaded) {
+		int count = 0;
+		_Volume_BVH *bvh_tree = _volume_build_bvh(bvh_arrayw, src_face_count, count);
+
+		bvh.resize(count + 1);
 
-	bvh.resize(count + 1);
+		BVH *bvh_arrayw2 = bvh.ptrw();
 
-	BVH *bvh_arrayw2 = bvh.ptrw();
+		int idx = 0;
+		_fill_bvh(bvh_tree, bvh_arrayw2, idx);
+	}
 
-	int idx = 0;
-	_fill_bvh(bvh_tree, bvh_arrayw2, idx);
+	// A loaded tree is already serialized, a new one is serialized the next time it's requested.
+	if (bvh_loaded && store_bvh) {
+		bvh_data = p_bvh_data;
+	} else {
+		bvh_data.clear();
+	}
 
 	backface_collision = p_backface_collision;
 
@@ -1674,13 +1786,25 @@ void GodotConcavePolygonShape3D::set_data(const Variant &p_data) {
 	Dictionary d = p_data;
 	ERR_FAIL_COND(!d.has("faces"));
 
-	_setup(d["faces"], d["backface_collision"]);
+	store_bvh = d.get("store_bvh", false);
+	if (!store_bvh) {
+		bvh_data.clear();
+	}
+
+	_setup(d["faces"], d["backface_collision"], d.get("bvh", Vector<uint8_t>()));
 }
 
 Variant GodotConcavePolygonShape3D::get_data() const {
 	Dictionary d;
 	d["faces"] = get_faces();
 	d["backface_collision"] = backface_collision;
+	d["store_bvh"] = store_bvh;
+	if (store_bvh) {
+		if (bvh_data.is_empty()) {
+			bvh_data = _save_bvh();
+		}
+		d["bvh"] = bvh_data;
+	}
 
 	return d;
 }
@@ -1770,6 +1894,29 @@ _FORCE_INLINE_ bool _heightmap_cell_cull_segment(_HeightmapSegmentCullParams &p_
 	return false;
 }
 
+_FORCE_INLINE_ bool _heightmap_cell_bounds_cull_segment(_HeightmapSegmentCullParams &p_params, const _HeightmapGridCullState &p_state) {
+	// Skip the triangle tests when the part of the segment crossing this cell
+	// is entirely above or below it.
+	if (p_state.length_flat > CMP_EPSILON) {
+		real_t flat_to_3d = p_state.length / p_state.length_flat;
+		real_t enter_y = p_params.from.y + p_params.dir.y * (p_state.prev_dist * flat_to_3d);
+		real_t exit_y = p_params.from.y + p_params.dir.y * (p_state.dist * flat_to_3d);
+
+		real_t cell_min;
+		real_t cell_max;
+		p_params.heightmap->_get_cell_range(p_state.x, p_state.z, cell_min, cell_max);
+
+		if ((enter_y > cell_max) && (exit_y > cell_max)) {
+			return false;
+		}
+		if ((enter_y < cell_min) && (exit_y < cell_min)) {
+			return false;
+		}
+	}
+
+	return _heightmap_cell_cull_segment(p_params, p_state);
+}
+
 _FORCE_INLINE_ bool _heightmap_chunk_cull_segment(_HeightmapSegmentCullParams &p_params, const _HeightmapGridCullState &p_state) {
 	const GodotHeightMapShape3D::Range &chunk = p_params.heightmap->_get_bounds_chunk(p_state.x, p_state.z);
 
@@ -1802,7 +1949,7 @@ _FORCE_INLINE_ bool _heightmap_chunk_cull_segment(_HeightmapSegmentCullParams &p
 		return false;
 	}
 
-	return p_params.heightmap->_intersect_grid_segment(_heightmap_cell_cull_segment, enter_pos, exit_pos, p_params.heightmap->width, p_params.heightmap->depth, p_params.heightmap->local_origin, p_params.result, p_params.normal);
+	return p_params.heightmap->_intersect_grid_segment(_heightmap_cell_bounds_cull_segment, enter_pos, exit_pos, p_params.heightmap->width, p_params.heightmap->depth, p_params.heightmap->local_origin, p_params.result, p_params.normal);
 }
 
 template <typename ProcessFunction>
@@ -1984,13 +2131,13 @@ bool GodotHeightMapShape3D::intersect_segment(const Vector3 &p_begin, const Vect
 		}
 	} else if (bounds_grid.is_empty()) {
 		// Process all cells intersecting the flat projection of the ray.
-		return _intersect_grid_segment(_heightmap_cell_cull_segment, p_begin, p_end, width, depth, local_origin, r_point, r_normal);
+		return _intersect_grid_segment(_heightmap_cell_bounds_cull_segment, p_begin, p_end, width, depth, local_origin, r_point, r_normal);
 	} else {
 		Vector3 ray_diff = (p_end - p_begin);
 		real_t length_flat_sqr = ray_diff.x * ray_diff.x + ray_diff.z * ray_diff.z;
 		if (length_flat_sqr < BOUNDS_CHUNK_SIZE * BOUNDS_CHUNK_SIZE) {
 			// Don't use chunks, the ray is too short in the plane.
-			return _intersect_grid_segment(_heightmap_cell_cull_segment, p_begin, p_end, width, depth, local_origin, r_point, r_normal);
+			return _intersect_grid_segment(_heightmap_cell_bounds_cull_segment, p_begin, p_end, width, depth, local_origin, r_point, r_normal);
 		} else {
 			// The ray is long, run raycast on a higher-level grid.
 			Vector3 bounds_from = p_begin / BOUNDS_CHUNK_SIZE;
@@ -2054,32 +2201,99 @@ void GodotHeightMapShape3D::cull(const AABB &p_local_aabb, QueryCallback p_callb
 	int start_z = MAX(0, aabb_min[2]);
 	int end_z = MIN(depth - 1, aabb_max[2]);
 
+	const real_t min_y = local_aabb.position.y;
+	const real_t max_y = local_aabb.position.y + local_aabb.size.y;
+
 	GodotFaceShape3D face;
 	face.backface_collision = !p_invert_backface_collision;
 	face.invert_backface_collision = p_invert_backface_collision;
 
-	for (int z = start_z; z < end_z; z++) {
-		for (int x = start_x; x < end_x; x++) {
-			// First triangle.
-			_get_point(x, z, face.vertex[0]);
-			_get_point(x + 1, z, face.vertex[1]);
-			_get_point(x, z + 1, face.vertex[2]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
-				return;
+	auto process_cells = [&](int p_start_x, int p_end_x, int p_start_z, int p_end_z) -> bool {
+		for (int z = p_start_z; z < p_end_z; z++) {
+			for (int x = p_start_x; x < p_end_x; x++) {
+				// Faces of cells entirely above or below the AABB can't touch it.
+				real_t cell_min;
+				real_t cell_max;
+				_get_cell_range(x, z, cell_min, cell_max);
+				if (cell_min > max_y || cell_max < min_y) {
+					continue;
+				}
+
+				// First triangle.
+				_get_point(x, z, face.vertex[0]);
+				_get_point(x + 1, z, face.vertex[1]);
+				_get_point(x, z + 1, face.vertex[2]);
+				face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
+				if (p_callback(p_userdata, &face)) {
+					return true;
+				}
+
+				// Second triangle.
+				face.vertex[0] = face.vertex[1];
+				_get_point(x + 1, z + 1, face.vertex[1]);
+				face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
+				if (p_callback(p_userdata, &face)) {
+					return true;
+				}
 			}
+		}
+		return false;
+	};
 
-			// Second triangle.
-			face.vertex[0] = face.vertex[1];
-			_get_point(x + 1, z + 1, face.vertex[1]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
+	if (bounds_levels.is_empty()) {
+		process_cells(start_x, end_x, start_z, end_z);
+		return;
+	}
+
+	// Walk the min/max quadtree from the top, only visiting the chunks that overlap the AABB.
+	const int top_level = bounds_levels.size();
+	const BoundsLevel &top = bounds_levels[top_level - 1];
+	for (int z = 0; z < top.depth; z++) {
+		for (int x = 0; x < top.width; x++) {
+			if (_cull_bounds_node(process_cells, top_level, x, z, start_x, end_x, start_z, end_z, min_y, max_y)) {
 				return;
 			}
 		}
 	}
 }
 
+template <typename ProcessFunction>
+bool GodotHeightMapShape3D::_cull_bounds_node(ProcessFunction &p_process, int p_level, int p_x, int p_z, int p_start_x, int p_end_x, int p_start_z, int p_end_z, real_t p_min_y, real_t p_max_y) const {
+	// Range of cells covered by this node, clipped to the queried range.
+	const int node_cells = BOUNDS_CHUNK_SIZE << p_level;
+	const int node_start_x = MAX(p_x * node_cells, p_start_x);
+	const int node_end_x = MIN((p_x + 1) * node_cells, p_end_x);
+	const int node_start_z = MAX(p_z * node_cells, p_start_z);
+	const int node_end_z = MIN((p_z + 1) * node_cells, p_end_z);
+	if (node_start_x >= node_end_x || node_start_z >= node_end_z) {
+		return false;
+	}
+
+	const Range &range = _get_bounds_node(p_level, p_x, p_z);
+	if (range.min > p_max_y || range.max < p_min_y) {
+		return false;
+	}
+
+	if (p_level == 0) {
+		return p_process(node_start_x, node_end_x, node_start_z, node_end_z);
+	}
+
+	const int child_level = p_level - 1;
+	const int child_width = (child_level == 0) ? bounds_grid_width : bounds_levels[child_level - 1].width;
+	const int child_depth = (child_level == 0) ? bounds_grid_depth : bounds_levels[child_level - 1].depth;
+	const int child_end_x = MIN(p_x * 2 + 2, child_width);
+	const int child_end_z = MIN(p_z * 2 + 2, child_depth);
+	for (int z = p_z * 2; z < child_end_z; z++) {
+		for (int x = p_x * 2; x < child_end_x; x++) {
+			if (_cull_bounds_node(p_process, child_level, x, z, p_start_x, p_end_x, p_start_z, p_end_z, p_min_y, p_max_y)) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
 Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
 	// use bad AABB approximation
 	Vector3 extents = get_aabb().size * 0.5;
@@ -2092,6 +2306,8 @@ Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
 
 void GodotHeightMapShape3D::_build_accelerator() {
 	bounds_grid.clear();
+	bounds_tree.clear();
+	bounds_levels.clear();
 
 	bounds_grid_width = width / BOUNDS_CHUNK_SIZE;
 	bounds_grid_depth = depth / BOUNDS_CHUNK_SIZE;
@@ -2114,48 +2330,95 @@ void GodotHeightMapShape3D::_build_accelerator() {
 	bounds_grid.resize(bound_grid_size);
 
 	// Compute min and max height for all chunks.
-	for (int cz = 0; cz < bounds_grid_depth; ++cz) {
-		int z0 = cz * BOUNDS_CHUNK_SIZE;
-
-		for (int cx = 0; cx < bounds_grid_width; ++cx) {
-			int x0 = cx * BOUNDS_CHUNK_SIZE;
-
-			Range r;
-
-			r.min = _get_height(x0, z0);
-			r.max = r.min;
-
-			// Compute min and max height for this chunk.
-			// We have to include one extra cell to account for neighbors.
-			// Here is why:
-			// Say we have a flat terrain, and a plateau that fits a chunk perfectly.
-			//
-			//   Left        Right
-			// 0---0---0---1---1---1
-			// |   |   |   |   |   |
-			// 0---0---0---1---1---1
-			// |   |   |   |   |   |
-			// 0---0---0---1---1---1
-			//           x
-			//
-			// If the AABB for the Left chunk did not share vertices with the Right,
-			// then we would fail collision tests at x due to a gap.
-			//
-			int z_max = MIN(z0 + BOUNDS_CHUNK_SIZE + 1, depth);
-			int x_max = MIN(x0 + BOUNDS_CHUNK_SIZE + 1, width);
-			for (int z = z0; z < z_max; ++z) {
-				for (int x = x0; x < x_max; ++x) {
-					real_t height = _get_height(x, z);
-					if (height < r.min) {
-						r.min = height;
-					} else if (height > r.max) {
-						r.max = height;
-					}
+	// Rows of chunks are independent, so large terrains are processed in parallel.
+	if (bound_grid_size >= BOUNDS_THREADED_BUILD_MIN_CHUNKS) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotHeightMapShape3D::_build_accelerator_row, nullptr, bounds_grid_depth, -1, true, SNAME("Physics3DHeightMapAccelerator"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (int cz = 0; cz < bounds_grid_depth; ++cz) {
+			_build_accelerator_row(cz, nullptr);
+		}
+	}
+
+	_build_bounds_tree();
+}
+
+void GodotHeightMapShape3D::_build_accelerator_row(uint32_t p_row, void *p_userdata) {
+	int cz = p_row;
+	int z0 = cz * BOUNDS_CHUNK_SIZE;
+
+	for (int cx = 0; cx < bounds_grid_width; ++cx) {
+		int x0 = cx * BOUNDS_CHUNK_SIZE;
+
+		Range r;
+
+		r.min = _get_height(x0, z0);
+		r.max = r.min;
+
+		// Compute min and max height for this chunk.
+		// We have to include one extra cell to account for neighbors.
+		// Here is why:
+		// Say we have a flat terrain, and a plateau that fits a chunk perfectly.
+		//
+		//   Left        Right
+		// 0---0---0---1---1---1
+		// |   |   |   |   |   |
+		// 0---0---0---1---1---1
+		// |   |   |   |   |   |
+		// 0---0---0---1---1---1
+		//           x
+		//
+		// If the AABB for the Left chunk did not share vertices with the Right,
+		// then we would fail collision tests at x due to a gap.
+		//
+		int z_max = MIN(z0 + BOUNDS_CHUNK_SIZE + 1, depth);
+		int x_max = MIN(x0 + BOUNDS_CHUNK_SIZE + 1, width);
+		for (int z = z0; z < z_max; ++z) {
+			for (int x = x0; x < x_max; ++x) {
+				real_t height = _get_height(x, z);
+				if (height < r.min) {
+					r.min = height;
+				} else if (height > r.max) {
+					r.max = height;
 				}
 			}
+		}
 
-			bounds_grid[cx + cz * bounds_grid_width] = r;
+		bounds_grid[cx + cz * bounds_grid_width] = r;
+	}
+}
+
+void GodotHeightMapShape3D::_build_bounds_tree() {
+	int child_width = bounds_grid_width;
+	int child_depth = bounds_grid_depth;
+
+	while (child_width > 1 || child_depth > 1) {
+		BoundsLevel level;
+		level.offset = bounds_tree.size();
+		level.width = (child_width + 1) / 2;
+		level.depth = (child_depth + 1) / 2;
+		bounds_tree.resize(level.offset + level.width * level.depth);
+		bounds_levels.push_back(level);
+
+		const int child_level = bounds_levels.size() - 1;
+		for (int z = 0; z < level.depth; z++) {
+			for (int x = 0; x < level.width; x++) {
+				Range r = _get_bounds_node(child_level, x * 2, z * 2);
+				const int child_end_x = MIN(x * 2 + 2, child_width);
+				const int child_end_z = MIN(z * 2 + 2, child_depth);
+				for (int cz = z * 2; cz < child_end_z; cz++) {
+					for (int cx = x * 2; cx < child_end_x; cx++) {
+						const Range &child = _get_bounds_node(child_level, cx, cz);
+						r.min = MIN(r.min, child.min);
+						r.max = MAX(r.max, child.max);
+					}
+				}
+				bounds_tree[level.offset + z * level.width + x] = r;
+			}
 		}
+
+		child_width = level.width;
+		child_depth = level.depth;
 	}
 }
 
@@ -2233,9 +2496,10 @@ void GodotHeightMapShape3D::set_data(const Variant &p_data) {
 		min_height = d["min_height"];
 		max_height = d["max_height"];
 	} else {
-		int heights_size = heights.size();
+		int heights_size = heights_buffer.size();
+		const real_t *heights_ptr = heights_buffer.ptr();
 		for (int i = 0; i < heights_size; ++i) {
-			real_t h = heights[i];
+			real_t h = heights_ptr[i];
 			if (h < min_height) {
 				min_height = h;
 			} else if (h > max_height) {
@@ -326,6 +326,10 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 
 	Vector<BVH> bvh;
 
+	// The BVH is only serialized in get_data() when requested through set_data(), and kept until the tree changes.
+	bool store_bvh = false;
+	mutable Vector<uint8_t> bvh_data;
+
 	struct _CullParams {
 		AABB aabb;
 		QueryCallback callback = nullptr;
@@ -359,7 +363,9 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 
 	void _fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx);
 
-	void _setup(const Vector<Vector3> &p_faces, bool p_backface_collision);
+	void _setup(const Vector<Vector3> &p_faces, bool p_backface_collision, const Vector<uint8_t> &p_bvh_data);
+	bool _load_bvh(const Vector<uint8_t> &p_bvh_data, const Vector<Vector3> &p_faces);
+	Vector<uint8_t> _save_bvh() const;
 
 public:
 	Vector<Vector3> get_faces() const;
@@ -398,14 +404,41 @@ struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 	int bounds_grid_width = 0;
 	int bounds_grid_depth = 0;
 
+	// Min/max quadtree built on top of the bounds grid, each level halves the resolution of the previous one.
+	struct BoundsLevel {
+		uint32_t offset = 0;
+		int width = 0;
+		int depth = 0;
+	};
+	LocalVector<Range> bounds_tree;
+	LocalVector<BoundsLevel> bounds_levels;
+
 	static const int BOUNDS_CHUNK_SIZE = 16;
+	static const int BOUNDS_THREADED_BUILD_MIN_CHUNKS = 1024;
 
 	_FORCE_INLINE_ const Range &_get_bounds_chunk(int p_x, int p_z) const {
 		return bounds_grid[(p_z * bounds_grid_width) + p_x];
 	}
 
+	// Level 0 is the bounds grid itself, higher levels are stored in the quadtree.
+	_FORCE_INLINE_ const Range &_get_bounds_node(int p_level, int p_x, int p_z) const {
+		if (p_level == 0) {
+			return _get_bounds_chunk(p_x, p_z);
+		}
+		const BoundsLevel &level = bounds_levels[p_level - 1];
+		return bounds_tree[level.offset + (p_z * level.width) + p_x];
+	}
+
 	_FORCE_INLINE_ real_t _get_height(int p_x, int p_z) const {
-		return heights[(p_z * width) + p_x];
+		ERR_FAIL_INDEX_V(p_x, width, 0.0);
+		ERR_FAIL_INDEX_V(p_z, depth, 0.0);
+		return heights.ptr()[(p_z * width) + p_x];
+	}
+
+	_FORCE_INLINE_ void _get_cell_range(int p_x, int p_z, real_t &r_min, real_t &r_max) const {
+		const real_t *row = heights.ptr() + (p_z * width) + p_x;
+		r_min = MIN(MIN(row[0], row[1]), MIN(row[width], row[width + 1]));
+		r_max = MAX(MAX(row[0], row[1]), MAX(row[width], row[width + 1]));
 	}
 
 	_FORCE_INLINE_ void _get_point(int p_x, int p_z, Vector3 &r_point) const {
@@ -417,6 +450,11 @@ struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 	void _get_cell(const Vector3 &p_point, int &r_x, int &r_y, int &r_z) const;
 
 	void _build_accelerator();
+	void _build_accelerator_row(uint32_t p_row, void *p_userdata);
+	void _build_bounds_tree();
+
+	template <typename ProcessFunction>
+	bool _cull_bounds_node(ProcessFunction &p_process, int p_level, int p_x, int p_z, int p_start_x, int p_end_x, int p_start_z, int p_end_z, real_t p_min_y, real_t p_max_y) const;
 
 	template <typename ProcessFunction>
 	bool _intersect_grid_segment(ProcessFunction &p_process, const Vector3 &p_begin, const Vector3 &p_end, int p_width, int p_depth, const Vector3 &offset, Vector3 &r_point, Vector3 &r_normal) const;
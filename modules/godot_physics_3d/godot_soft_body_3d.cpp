@@ -33,6 +33,7 @@
 #include "godot_space_3d.h"
 
 #include "core/math/geometry_3d.h"
+#include "core/object/worker_thread_pool.h"
 #include "servers/rendering_server.h"
 
 // Based on Bullet soft body.
@@ -190,18 +191,13 @@ void GodotSoftBody3D::update_normals_and_centroids() {
 	}
 }
 
-void GodotSoftBody3D::update_bounds() {
+bool GodotSoftBody3D::compute_bounds() {
 	AABB prev_bounds = bounds;
 	prev_bounds.grow_by(collision_margin);
 
 	bounds = AABB();
 
 	const uint32_t nodes_count = nodes.size();
-	if (nodes_count == 0) {
-		deinitialize_shape();
-		return;
-	}
-
 	bool first = true;
 	bool moved = false;
 	for (uint32_t node_index = 0; node_index < nodes_count; ++node_index) {
@@ -217,8 +213,22 @@ void GodotSoftBody3D::update_bounds() {
 		}
 	}
 
+	return moved;
+}
+
+void GodotSoftBody3D::update_bounds() {
+	bounds_moved = compute_bounds();
+	update_shape_bounds();
+}
+
+void GodotSoftBody3D::update_shape_bounds() {
+	if (nodes.is_empty()) {
+		deinitialize_shape();
+		return;
+	}
+
 	if (get_space()) {
-		initialize_shape(moved);
+		initialize_shape(bounds_moved);
 	}
 }
 
@@ -581,6 +591,7 @@ bool GodotSoftBody3D::create_from_trimesh(const Vector<int> &p_indices, const Ve
 
 	generate_bending_constraints(2);
 	reoptimize_link_order();
+	build_link_batches();
 
 	update_constants();
 	update_normals_and_centroids();
@@ -825,6 +836,61 @@ void GodotSoftBody3D::reoptimize_link_order() {
 	memdelete_arr(link_buffer);
 }
 
+void GodotSoftBody3D::build_link_batches() {
+	link_batch_offsets.clear();
+
+	const uint32_t link_count = links.size();
+	if (link_count < LINK_BATCH_MIN_LINKS) {
+		return;
+	}
+
+	static_assert(LINK_BATCH_COUNT <= 64);
+	const uint32_t serial_batch = LINK_BATCH_COUNT - 1;
+
+	// Greedy coloring: each link goes to the first batch none of its nodes are part of yet.
+	LocalVector<uint64_t> node_batch_masks;
+	node_batch_masks.resize(nodes.size());
+	memset(node_batch_masks.ptr(), 0, node_batch_masks.size() * sizeof(uint64_t));
+
+	LocalVector<uint8_t> link_batches;
+	link_batches.resize(link_count);
+
+	link_batch_offsets.resize(LINK_BATCH_COUNT + 1);
+	memset(link_batch_offsets.ptr(), 0, link_batch_offsets.size() * sizeof(uint32_t));
+
+	for (uint32_t i = 0; i < link_count; ++i) {
+		const Link &link = links[i];
+		uint64_t &mask_a = node_batch_masks[link.n[0]->index];
+		uint64_t &mask_b = node_batch_masks[link.n[1]->index];
+		const uint64_t used = mask_a | mask_b;
+
+		uint32_t batch = 0;
+		while (batch < serial_batch && (used & (uint64_t(1) << batch))) {
+			++batch;
+		}
+		if (batch < serial_batch) {
+			mask_a |= uint64_t(1) << batch;
+			mask_b |= uint64_t(1) << batch;
+		}
+
+		link_batches[i] = batch;
+		link_batch_offsets[batch + 1]++;
+	}
+
+	for (uint32_t batch = 0; batch < LINK_BATCH_COUNT; ++batch) {
+		link_batch_offsets[batch + 1] += link_batch_offsets[batch];
+	}
+
+	// Stable sort by batch, so links keep the order computed by reoptimize_link_order() within a batch.
+	LocalVector<Link> sorted_links;
+	sorted_links.resize(link_count);
+	LocalVector<uint32_t> write_offsets = link_batch_offsets;
+	for (uint32_t i = 0; i < link_count; ++i) {
+		sorted_links[write_offsets[link_batches[i]]++] = links[i];
+	}
+	links = sorted_links;
+}
+
 void GodotSoftBody3D::append_link(uint32_t p_node1, uint32_t p_node2) {
 	if (p_node1 == p_node2) {
 		return;
@@ -1044,8 +1110,8 @@ void GodotSoftBody3D::predict_motion(real_t p_delta) {
 		node.f = Vector3();
 	}
 
-	// Bounds and tree update.
-	update_bounds();
+	// Bounds update, the shape is updated later in update_shape_bounds().
+	bounds_moved = compute_bounds();
 
 	// Node tree update.
 	for (const Node &node : nodes) {
@@ -1066,7 +1132,7 @@ void GodotSoftBody3D::predict_motion(real_t p_delta) {
 	face_tree.optimize_incremental(1);
 }
 
-void GodotSoftBody3D::solve_constraints(real_t p_delta) {
+void GodotSoftBody3D::solve_constraints(real_t p_delta, bool p_multithreaded) {
 	const real_t inv_delta = 1.0 / p_delta;
 
 	for (Link &link : links) {
@@ -1082,7 +1148,7 @@ void GodotSoftBody3D::solve_constraints(real_t p_delta) {
 	// Solve positions.
 	for (int isolve = 0; isolve < iteration_count; ++isolve) {
 		const real_t ti = isolve / (real_t)iteration_count;
-		solve_links(1.0, ti);
+		solve_links(1.0, ti, p_multithreaded);
 	}
 	const real_t vc = (1.0 - damping_coefficient) * inv_delta;
 	for (Node &node : nodes) {
@@ -1097,8 +1163,40 @@ void GodotSoftBody3D::solve_constraints(real_t p_delta) {
 	update_normals_and_centroids();
 }
 
-void GodotSoftBody3D::solve_links(real_t kst, real_t ti) {
-	for (Link &link : links) {
+void GodotSoftBody3D::solve_links(real_t kst, real_t ti, bool p_multithreaded) {
+	if (link_batch_offsets.is_empty()) {
+		solve_link_range(0, links.size(), kst);
+		return;
+	}
+
+	// Links are solved batch by batch in the same order whether threads are used or not,
+	// and links within a batch don't interact, so the result is the same in both cases.
+	for (uint32_t batch = 0; batch < LINK_BATCH_COUNT; ++batch) {
+		LinkSolveBatch solve_batch;
+		solve_batch.begin = link_batch_offsets[batch];
+		solve_batch.end = link_batch_offsets[batch + 1];
+		solve_batch.kst = kst;
+
+		const uint32_t link_count = solve_batch.end - solve_batch.begin;
+		if (p_multithreaded && batch < LINK_BATCH_COUNT - 1 && link_count > LINK_SOLVE_CHUNK_SIZE) {
+			const uint32_t chunk_count = (link_count + LINK_SOLVE_CHUNK_SIZE - 1) / LINK_SOLVE_CHUNK_SIZE;
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotSoftBody3D::_solve_link_chunk, &solve_batch, chunk_count, -1, true, SNAME("SoftBody3DSolveLinks"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			solve_link_range(solve_batch.begin, solve_batch.end, kst);
+		}
+	}
+}
+
+void GodotSoftBody3D::_solve_link_chunk(uint32_t p_chunk_index, const LinkSolveBatch *p_batch) {
+	const uint32_t begin = p_batch->begin + p_chunk_index * LINK_SOLVE_CHUNK_SIZE;
+	const uint32_t end = MIN(begin + LINK_SOLVE_CHUNK_SIZE, p_batch->end);
+	solve_link_range(begin, end, p_batch->kst);
+}
+
+void GodotSoftBody3D::solve_link_range(uint32_t p_begin, uint32_t p_end, real_t kst) {
+	for (uint32_t i = p_begin; i < p_end; ++i) {
+		Link &link = links[i];
 		if (link.c0 > 0) {
 			Node &node_a = *link.n[0];
 			Node &node_b = *link.n[1];
@@ -1220,6 +1318,7 @@ void GodotSoftBody3D::destroy() {
 
 	nodes.clear();
 	links.clear();
+	link_batch_offsets.clear();
 	faces.clear();
 
 	bounds = AABB();
@@ -82,6 +82,22 @@ class GodotSoftBody3D : public GodotCollisionObject3D {
 	LocalVector<Link> links;
 	LocalVector<Face> faces;
 
+	// Large soft bodies have their links sorted in batches that don't share any node,
+	// so each batch can be solved on multiple threads. The last batch holds the links
+	// that couldn't fit in any other batch, and is always solved serially.
+	static const uint32_t LINK_BATCH_COUNT = 64;
+	static const uint32_t LINK_BATCH_MIN_LINKS = 8192;
+	static const uint32_t LINK_SOLVE_CHUNK_SIZE = 1024;
+
+	struct LinkSolveBatch {
+		uint32_t begin = 0;
+		uint32_t end = 0;
+		real_t kst = 0.0;
+	};
+
+	LocalVector<uint32_t> link_batch_offsets;
+	bool bounds_moved = false;
+
 	DynamicBVH node_tree;
 	DynamicBVH face_tree;
 
@@ -201,8 +217,16 @@ public:
 	void set_drag_coefficient(real_t p_val);
 	_FORCE_INLINE_ real_t get_drag_coefficient() const { return drag_coefficient; }
 
+	// Safe to call for different soft bodies in parallel.
+	// update_shape_bounds() must then be called from the stepping thread.
 	void predict_motion(real_t p_delta);
-	void solve_constraints(real_t p_delta);
+	void update_shape_bounds();
+
+	// When p_multithreaded is true, the links of large soft bodies are solved using
+	// the WorkerThreadPool, so it must not be called from a worker thread.
+	// Otherwise it's safe to call for different soft bodies in parallel.
+	void solve_constraints(real_t p_delta, bool p_multithreaded = false);
+	_FORCE_INLINE_ bool has_link_batches() const { return !link_batch_offsets.is_empty(); }
 
 	_FORCE_INLINE_ uint32_t get_node_index(void *p_node) const { return static_cast<Node *>(p_node)->index; }
 	_FORCE_INLINE_ uint32_t get_face_index(void *p_face) const { return static_cast<Face *>(p_face)->index; }
@@ -219,6 +243,7 @@ protected:
 
 private:
 	void update_normals_and_centroids();
+	bool compute_bounds();
 	void update_bounds();
 	void update_constants();
 	void update_area();
@@ -234,10 +259,13 @@ private:
 	bool create_from_trimesh(const Vector<int> &p_indices, const Vector<Vector3> &p_vertices);
 	void generate_bending_constraints(int p_distance);
 	void reoptimize_link_order();
+	void build_link_batches();
 	void append_link(uint32_t p_node1, uint32_t p_node2);
 	void append_face(uint32_t p_node1, uint32_t p_node2, uint32_t p_node3);
 
-	void solve_links(real_t kst, real_t ti);
+	void solve_links(real_t kst, real_t ti, bool p_multithreaded);
+	void solve_link_range(uint32_t p_begin, uint32_t p_end, real_t kst);
+	void _solve_link_chunk(uint32_t p_chunk_index, const LinkSolveBatch *p_batch);
 
 	void initialize_face_tree();
 	void update_face_tree(real_t p_delta);
@@ -40,6 +40,65 @@
 #define TEST_MOTION_MARGIN_MIN_VALUE 0.0001
 #define TEST_MOTION_MIN_CONTACT_DEPTH_FACTOR 0.05
 
+// Space snapshots are stored with native endianness and precision, they are
+// only meant to be restored by the same build that saved them (e.g. rollback).
+#define SPACE_STATE_MAGIC 0x53504447 // "GDPS"
+#define SPACE_STATE_VERSION 1
+
+struct SpaceStateHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t real_size;
+	uint32_t body_count;
+	uint32_t pair_count;
+};
+
+struct SpaceStateBody {
+	uint64_t rid;
+	Transform3D transform;
+	Vector3 linear_velocity;
+	Vector3 angular_velocity;
+	real_t still_time;
+	uint32_t active;
+};
+
+struct SpaceStatePair {
+	uint64_t rid_A;
+	uint64_t rid_B;
+	int32_t shape_A;
+	int32_t shape_B;
+	Vector3 sep_axis;
+	uint32_t contact_count;
+};
+
+struct SpaceStateContact {
+	int32_t index_A;
+	int32_t index_B;
+	Vector3 local_A;
+	Vector3 local_B;
+	Vector3 normal;
+	Vector3 acc_tangent_impulse;
+	real_t acc_normal_impulse;
+	real_t acc_bias_impulse;
+	real_t acc_bias_impulse_center_of_mass;
+};
+
+template <typename T>
+_FORCE_INLINE_ static void _state_write(uint8_t *&r_ptr, const T &p_value) {
+	memcpy(r_ptr, &p_value, sizeof(T));
+	r_ptr += sizeof(T);
+}
+
+template <typename T>
+_FORCE_INLINE_ static bool _state_read(const uint8_t *&r_ptr, const uint8_t *p_end, T &r_value) {
+	if (r_ptr + sizeof(T) > p_end) {
+		return false;
+	}
+	memcpy(&r_value, r_ptr, sizeof(T));
+	r_ptr += sizeof(T);
+	return true;
+}
+
 _FORCE_INLINE_ static bool _can_collide_with(GodotCollisionObject3D *p_object, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas) {
 	if (!(p_object->get_collision_layer() & p_collision_mask)) {
 		return false;
@@ -617,28 +676,28 @@ GodotPhysicsDirectSpaceState3D::GodotPhysicsDirectSpaceState3D() {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-int GodotSpace3D::_cull_aabb_for_body(GodotBody3D *p_body, const AABB &p_aabb) {
-	int amount = broadphase->cull_aabb(p_aabb, intersection_query_results, INTERSECTION_QUERY_MAX, intersection_query_subindex_results);
+int GodotSpace3D::_cull_aabb_for_body(GodotBody3D *p_body, const AABB &p_aabb, GodotCollisionObject3D **r_results, int *r_subindex_results) {
+	int amount = broadphase->cull_aabb(p_aabb, r_results, INTERSECTION_QUERY_MAX, r_subindex_results);
 
 	for (int i = 0; i < amount; i++) {
 		bool keep = true;
 
-		if (intersection_query_results[i] == p_body) {
+		if (r_results[i] == p_body) {
 			keep = false;
-		} else if (intersection_query_results[i]->get_type() == GodotCollisionObject3D::TYPE_AREA) {
+		} else if (r_results[i]->get_type() == GodotCollisionObject3D::TYPE_AREA) {
 			keep = false;
-		} else if (intersection_query_results[i]->get_type() == GodotCollisionObject3D::TYPE_SOFT_BODY) {
+		} else if (r_results[i]->get_type() == GodotCollisionObject3D::TYPE_SOFT_BODY) {
 			keep = false;
-		} else if (!p_body->collides_with(static_cast<GodotBody3D *>(intersection_query_results[i]))) {
+		} else if (!p_body->collides_with(static_cast<GodotBody3D *>(r_results[i]))) {
 			keep = false;
-		} else if (static_cast<GodotBody3D *>(intersection_query_results[i])->has_exception(p_body->get_self()) || p_body->has_exception(intersection_query_results[i]->get_self())) {
+		} else if (static_cast<GodotBody3D *>(r_results[i])->has_exception(p_body->get_self()) || p_body->has_exception(r_results[i]->get_self())) {
 			keep = false;
 		}
 
 		if (!keep) {
 			if (i < amount - 1) {
-				SWAP(intersection_query_results[i], intersection_query_results[amount - 1]);
-				SWAP(intersection_query_subindex_results[i], intersection_query_subindex_results[amount - 1]);
+				SWAP(r_results[i], r_results[amount - 1]);
+				SWAP(r_subindex_results[i], r_subindex_results[amount - 1]);
 			}
 
 			amount--;
@@ -649,7 +708,7 @@ int GodotSpace3D::_cull_aabb_for_body(GodotBody3D *p_body, const AABB &p_aabb) {
 	return amount;
 }
 
-bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::MotionParameters &p_parameters, PhysicsServer3D::MotionResult *r_result) {
+bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::MotionParameters &p_parameters, PhysicsServer3D::MotionResult *r_result, GodotCollisionObject3D **r_query_results, int *r_query_subindex_results) {
 	//give me back regular physics engine logic
 	//this is madness
 	//and most people using this function will think
@@ -722,7 +781,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 
 			bool collided = false;
 
-			int amount = _cull_aabb_for_body(p_body, body_aabb);
+			int amount = _cull_aabb_for_body(p_body, body_aabb, r_query_results, r_query_subindex_results);
 
 			for (int j = 0; j < p_body->get_shape_count(); j++) {
 				if (p_body->is_shape_disabled(j)) {
@@ -733,7 +792,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 				GodotShape3D *body_shape = p_body->get_shape(j);
 
 				for (int i = 0; i < amount; i++) {
-					const GodotCollisionObject3D *col_obj = intersection_query_results[i];
+					const GodotCollisionObject3D *col_obj = r_query_results[i];
 					if (p_parameters.exclude_bodies.has(col_obj->get_self())) {
 						continue;
 					}
@@ -741,7 +800,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 						continue;
 					}
 
-					int shape_idx = intersection_query_subindex_results[i];
+					int shape_idx = r_query_subindex_results[i];
 
 					if (GodotCollisionSolver3D::solve_static(body_shape, body_shape_xform, col_obj->get_shape(shape_idx), col_obj->get_transform() * col_obj->get_shape_transform(shape_idx), cbkres, cbkptr, nullptr, margin)) {
 						collided = cbk.amount > 0;
@@ -806,7 +865,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 		motion_aabb.position += p_parameters.motion;
 		motion_aabb = motion_aabb.merge(body_aabb);
 
-		int amount = _cull_aabb_for_body(p_body, motion_aabb);
+		int amount = _cull_aabb_for_body(p_body, motion_aabb, r_query_results, r_query_subindex_results);
 
 		for (int j = 0; j < p_body->get_shape_count(); j++) {
 			if (p_body->is_shape_disabled(j)) {
@@ -837,7 +896,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 			real_t best_unsafe = 1;
 
 			for (int i = 0; i < amount; i++) {
-				const GodotCollisionObject3D *col_obj = intersection_query_results[i];
+				const GodotCollisionObject3D *col_obj = r_query_results[i];
 				if (p_parameters.exclude_bodies.has(col_obj->get_self())) {
 					continue;
 				}
@@ -845,7 +904,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 					continue;
 				}
 
-				int shape_idx = intersection_query_subindex_results[i];
+				int shape_idx = r_query_subindex_results[i];
 
 				//test initial overlap, does it collide if going all the way?
 				Vector3 point_A, point_B;
@@ -946,7 +1005,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 		rcd.min_allowed_depth = MIN(motion_length, min_contact_depth);
 
 		body_aabb.position += p_parameters.motion * unsafe;
-		int amount = _cull_aabb_for_body(p_body, body_aabb);
+		int amount = _cull_aabb_for_body(p_body, body_aabb, r_query_results, r_query_subindex_results);
 
 		int from_shape = best_shape != -1 ? best_shape : 0;
 		int to_shape = best_shape != -1 ? best_shape + 1 : p_body->get_shape_count();
@@ -960,7 +1019,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 			GodotShape3D *body_shape = p_body->get_shape(j);
 
 			for (int i = 0; i < amount; i++) {
-				const GodotCollisionObject3D *col_obj = intersection_query_results[i];
+				const GodotCollisionObject3D *col_obj = r_query_results[i];
 				if (p_parameters.exclude_bodies.has(col_obj->get_self())) {
 					continue;
 				}
@@ -968,7 +1027,7 @@ bool GodotSpace3D::test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::
 					continue;
 				}
 
-				int shape_idx = intersection_query_subindex_results[i];
+				int shape_idx = r_query_subindex_results[i];
 
 				rcd.object = col_obj;
 				rcd.shape = shape_idx;
@@ -1256,6 +1315,193 @@ GodotPhysicsDirectSpaceState3D *GodotSpace3D::get_direct_state() {
 	return direct_access;
 }
 
+Vector<uint8_t> GodotSpace3D::save_state() const {
+	LocalVector<const GodotBody3D *> bodies;
+	LocalVector<const GodotBodyPair3D *> pairs;
+	uint32_t contact_count = 0;
+
+	for (const GodotCollisionObject3D *E : objects) {
+		if (E->get_type() != GodotCollisionObject3D::TYPE_BODY) {
+			continue;
+		}
+		const GodotBody3D *body = static_cast<const GodotBody3D *>(E);
+		bodies.push_back(body);
+
+		for (const KeyValue<GodotConstraint3D *, int> &F : body->get_constraint_map()) {
+			// Each pair is referenced by both bodies, only store it from the first one.
+			if (F.value != 0 || !F.key->is_body_pair()) {
+				continue;
+			}
+			const GodotBodyPair3D *pair = static_cast<const GodotBodyPair3D *>(F.key);
+			if (pair->contact_count == 0) {
+				continue;
+			}
+			pairs.push_back(pair);
+			contact_count += pair->contact_count;
+		}
+	}
+
+	Vector<uint8_t> state;
+	state.resize(sizeof(SpaceStateHeader) + bodies.size() * sizeof(SpaceStateBody) + pairs.size() * sizeof(SpaceStatePair) + contact_count * sizeof(SpaceStateContact));
+	uint8_t *w = state.ptrw();
+
+	SpaceStateHeader header;
+	memset(&header, 0, sizeof(header));
+	header.magic = SPACE_STATE_MAGIC;
+	header.version = SPACE_STATE_VERSION;
+	header.real_size = sizeof(real_t);
+	header.body_count = bodies.size();
+	header.pair_count = pairs.size();
+	_state_write(w, header);
+
+	for (const GodotBody3D *body : bodies) {
+		SpaceStateBody b;
+		memset(&b, 0, sizeof(b));
+		b.rid = body->get_self().get_id();
+		b.transform = body->get_transform();
+		b.linear_velocity = body->get_linear_velocity();
+		b.angular_velocity = body->get_angular_velocity();
+		b.still_time = body->get_still_time();
+		b.active = body->is_active();
+		_state_write(w, b);
+	}
+
+	for (const GodotBodyPair3D *pair : pairs) {
+		SpaceStatePair p;
+		memset(&p, 0, sizeof(p));
+		p.rid_A = pair->A->get_self().get_id();
+		p.rid_B = pair->B->get_self().get_id();
+		p.shape_A = pair->shape_A;
+		p.shape_B = pair->shape_B;
+		p.sep_axis = pair->sep_axis;
+		p.contact_count = pair->contact_count;
+		_state_write(w, p);
+
+		for (int i = 0; i < pair->contact_count; i++) {
+			const GodotBodyPair3D::Contact &contact = pair->contacts[i];
+			SpaceStateContact c;
+			memset(&c, 0, sizeof(c));
+			c.index_A = contact.index_A;
+			c.index_B = contact.index_B;
+			c.local_A = contact.local_A;
+			c.local_B = contact.local_B;
+			c.normal = contact.normal;
+			c.acc_tangent_impulse = contact.acc_tangent_impulse;
+			c.acc_normal_impulse = contact.acc_normal_impulse;
+			c.acc_bias_impulse = contact.acc_bias_impulse;
+			c.acc_bias_impulse_center_of_mass = contact.acc_bias_impulse_center_of_mass;
+			_state_write(w, c);
+		}
+	}
+
+	return state;
+}
+
+Error GodotSpace3D::restore_state(const Vector<uint8_t> &p_state) {
+	ERR_FAIL_COND_V_MSG(locked, ERR_LOCKED, "Space state can't be restored while the space is being stepped.");
+
+	const uint8_t *r = p_state.ptr();
+	const uint8_t *end = r + p_state.size();
+
+	SpaceStateHeader header;
+	ERR_FAIL_COND_V(!_state_read(r, end, header), ERR_INVALID_DATA);
+	ERR_FAIL_COND_V_MSG(header.magic != SPACE_STATE_MAGIC, ERR_FILE_UNRECOGNIZED, "Not a space state.");
+	ERR_FAIL_COND_V_MSG(header.version != SPACE_STATE_VERSION, ERR_FILE_UNRECOGNIZED, vformat("Unsupported space state version: %d.", header.version));
+	ERR_FAIL_COND_V_MSG(header.real_size != sizeof(real_t), ERR_FILE_UNRECOGNIZED, "Space state was saved with a different floating-point precision.");
+
+	// Validate the whole snapshot before touching any body.
+	{
+		ERR_FAIL_COND_V(uint64_t(end - r) < uint64_t(header.body_count) * sizeof(SpaceStateBody), ERR_INVALID_DATA);
+		const uint8_t *pr = r + header.body_count * sizeof(SpaceStateBody);
+		for (uint32_t i = 0; i < header.pair_count; i++) {
+			SpaceStatePair p;
+			ERR_FAIL_COND_V(!_state_read(pr, end, p), ERR_INVALID_DATA);
+			ERR_FAIL_COND_V(p.contact_count > GodotBodyPair3D::MAX_CONTACTS, ERR_INVALID_DATA);
+			ERR_FAIL_COND_V(uint64_t(end - pr) < p.contact_count * sizeof(SpaceStateContact), ERR_INVALID_DATA);
+			pr += p.contact_count * sizeof(SpaceStateContact);
+		}
+		ERR_FAIL_COND_V(pr != end, ERR_INVALID_DATA);
+	}
+
+	HashMap<uint64_t, GodotBody3D *> bodies;
+	bodies.reserve(objects.size());
+	for (GodotCollisionObject3D *E : objects) {
+		if (E->get_type() == GodotCollisionObject3D::TYPE_BODY) {
+			bodies.insert(E->get_self().get_id(), static_cast<GodotBody3D *>(E));
+		}
+	}
+
+	for (uint32_t i = 0; i < header.body_count; i++) {
+		SpaceStateBody b;
+		_state_read(r, end, b);
+		GodotBody3D **body = bodies.getptr(b.rid);
+		if (!body) {
+			// The body was removed from the space since the state was saved.
+			continue;
+		}
+		(*body)->restore_state(b.transform, b.linear_velocity, b.angular_velocity, b.still_time, b.active);
+	}
+
+	// Create the pairs for the restored transforms, then replace their
+	// warm-starting data with the one from the snapshot.
+	broadphase->update();
+
+	for (const KeyValue<uint64_t, GodotBody3D *> &E : bodies) {
+		for (const KeyValue<GodotConstraint3D *, int> &F : E.value->get_constraint_map()) {
+			if (F.value == 0 && F.key->is_body_pair()) {
+				static_cast<GodotBodyPair3D *>(F.key)->contact_count = 0;
+			}
+		}
+	}
+
+	for (uint32_t i = 0; i < header.pair_count; i++) {
+		SpaceStatePair p;
+		_state_read(r, end, p);
+
+		GodotBodyPair3D *pair = nullptr;
+		GodotBody3D **body_A = bodies.getptr(p.rid_A);
+		if (body_A) {
+			for (const KeyValue<GodotConstraint3D *, int> &F : (*body_A)->get_constraint_map()) {
+				if (F.value != 0 || !F.key->is_body_pair()) {
+					continue;
+				}
+				GodotBodyPair3D *candidate = static_cast<GodotBodyPair3D *>(F.key);
+				if (candidate->B->get_self().get_id() == p.rid_B && candidate->shape_A == p.shape_A && candidate->shape_B == p.shape_B) {
+					pair = candidate;
+					break;
+				}
+			}
+		}
+
+		if (pair) {
+			pair->sep_axis = p.sep_axis;
+			pair->contact_count = p.contact_count;
+		}
+
+		for (uint32_t j = 0; j < p.contact_count; j++) {
+			SpaceStateContact c;
+			_state_read(r, end, c);
+			if (!pair) {
+				continue;
+			}
+			GodotBodyPair3D::Contact &contact = pair->contacts[j];
+			contact = GodotBodyPair3D::Contact();
+			contact.index_A = c.index_A;
+			contact.index_B = c.index_B;
+			contact.local_A = c.local_A;
+			contact.local_B = c.local_B;
+			contact.normal = c.normal;
+			contact.acc_tangent_impulse = c.acc_tangent_impulse;
+			contact.acc_normal_impulse = c.acc_normal_impulse;
+			contact.acc_bias_impulse = c.acc_bias_impulse;
+			contact.acc_bias_impulse_center_of_mass = c.acc_bias_impulse_center_of_mass;
+			contact.used = true;
+		}
+	}
+
+	return OK;
+}
+
 GodotSpace3D::GodotSpace3D() {
 	body_linear_velocity_sleep_threshold = GLOBAL_GET("physics/3d/sleep_threshold_linear");
 	body_angular_velocity_sleep_threshold = GLOBAL_GET("physics/3d/sleep_threshold_angular");
@@ -68,6 +68,10 @@ public:
 
 	};
 
+	enum {
+		INTERSECTION_QUERY_MAX = 2048
+	};
+
 private:
 	uint64_t elapsed_time[ELAPSED_TIME_MAX] = {};
 
@@ -96,10 +100,6 @@ private:
 	real_t contact_max_allowed_penetration = 0.0;
 	real_t contact_bias = 0.0;
 
-	enum {
-		INTERSECTION_QUERY_MAX = 2048
-	};
-
 	GodotCollisionObject3D *intersection_query_results[INTERSECTION_QUERY_MAX];
 	int intersection_query_subindex_results[INTERSECTION_QUERY_MAX];
 
@@ -122,7 +122,7 @@ private:
 
 	friend class GodotPhysicsDirectSpaceState3D;
 
-	int _cull_aabb_for_body(GodotBody3D *p_body, const AABB &p_aabb);
+	int _cull_aabb_for_body(GodotBody3D *p_body, const AABB &p_aabb, GodotCollisionObject3D **r_results, int *r_subindex_results);
 
 public:
 	_FORCE_INLINE_ void set_self(const RID &p_self) { self = p_self; }
@@ -205,7 +205,15 @@ public:
 	void set_elapsed_time(ElapsedTime p_time, uint64_t p_msec) { elapsed_time[p_time] = p_msec; }
 	uint64_t get_elapsed_time(ElapsedTime p_time) const { return elapsed_time[p_time]; }
 
-	bool test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::MotionParameters &p_parameters, PhysicsServer3D::MotionResult *r_result);
+	_FORCE_INLINE_ bool test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::MotionParameters &p_parameters, PhysicsServer3D::MotionResult *r_result) {
+		return test_body_motion(p_body, p_parameters, r_result, intersection_query_results, intersection_query_subindex_results);
+	}
+	// Doesn't modify the space, so it can be called from multiple threads as long as
+	// each one provides its own query buffers (of INTERSECTION_QUERY_MAX elements).
+	bool test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::MotionParameters &p_parameters, PhysicsServer3D::MotionResult *r_result, GodotCollisionObject3D **r_query_results, int *r_query_subindex_results);
+
+	Vector<uint8_t> save_state() const;
+	Error restore_state(const Vector<uint8_t> &p_state);
 
 	GodotSpace3D();
 	~GodotSpace3D();
@@ -182,6 +182,14 @@ void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island
 	}
 }
 
+void GodotStep3D::_predict_soft_body_motion(uint32_t p_soft_body_index, void *p_userdata) {
+	soft_bodies[p_soft_body_index]->predict_motion(delta);
+}
+
+void GodotStep3D::_solve_soft_body_constraints(uint32_t p_soft_body_index, void *p_userdata) {
+	soft_bodies[p_soft_body_index]->solve_constraints(delta);
+}
+
 void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	p_space->lock(); // can't access space during this
 
@@ -212,12 +220,33 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* UPDATE SOFT BODY MOTION */
 
+	// Soft bodies that solve their links on multiple threads are sorted last,
+	// the others are solved in parallel with each other.
+	soft_bodies.clear();
 	const SelfList<GodotSoftBody3D> *sb = soft_body_list->first();
 	while (sb) {
-		sb->self()->predict_motion(p_delta);
+		if (!sb->self()->has_link_batches()) {
+			soft_bodies.push_back(sb->self());
+		}
 		sb = sb->next();
 		active_count++;
 	}
+	parallel_soft_body_count = soft_bodies.size();
+	sb = soft_body_list->first();
+	while (sb) {
+		if (sb->self()->has_link_batches()) {
+			soft_bodies.push_back(sb->self());
+		}
+		sb = sb->next();
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_predict_soft_body_motion, nullptr, soft_bodies.size(), -1, true, SNAME("Physics3DSoftBodyPredictMotion"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// Updating shapes affects the broadphase, so it can't be done in parallel.
+	for (GodotSoftBody3D *soft_body : soft_bodies) {
+		soft_body->update_shape_bounds();
+	}
 
 	p_space->set_active_objects(active_count);
 
@@ -344,7 +373,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
 	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -390,10 +419,11 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* UPDATE SOFT BODY CONSTRAINTS */
 
-	sb = soft_body_list->first();
-	while (sb) {
-		sb->self()->solve_constraints(p_delta);
-		sb = sb->next();
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_soft_body_constraints, nullptr, parallel_soft_body_count, -1, true, SNAME("Physics3DSoftBodySolveConstraints"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	for (uint32_t soft_body_index = parallel_soft_body_count; soft_body_index < soft_bodies.size(); ++soft_body_index) {
+		soft_bodies[soft_body_index]->solve_constraints(p_delta, true);
 	}
 
 	{ //profile
@@ -403,6 +433,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	}
 
 	all_constraints.clear();
+	soft_bodies.clear();
 
 	p_space->unlock();
 	_step++;
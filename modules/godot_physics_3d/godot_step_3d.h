@@ -44,6 +44,8 @@ class GodotStep3D {
 	LocalVector<LocalVector<GodotBody3D *>> body_islands;
 	LocalVector<LocalVector<GodotConstraint3D *>> constraint_islands;
 	LocalVector<GodotConstraint3D *> all_constraints;
+	LocalVector<GodotSoftBody3D *> soft_bodies;
+	uint32_t parallel_soft_body_count = 0;
 
 	void _populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _populate_island_soft_body(GodotSoftBody3D *p_soft_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
@@ -51,6 +53,8 @@ class GodotStep3D {
 	void _pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const;
 	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr);
 	void _check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const;
+	void _predict_soft_body_motion(uint32_t p_soft_body_index, void *p_userdata = nullptr);
+	void _solve_soft_body_constraints(uint32_t p_soft_body_index, void *p_userdata = nullptr);
 
 public:
 	void step(GodotSpace3D *p_space, real_t p_delta);
@@ -0,0 +1,219 @@
+/**************************************************************************/
+/*  test_godot_shape_3d.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_GODOT_SHAPE_3D_H
+#define TEST_GODOT_SHAPE_3D_H
+
+#include "../godot_shape_3d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGodotShape3D {
+
+static bool _collect_faces(void *p_userdata, GodotShape3D *p_convex) {
+	LocalVector<Face3> *faces = static_cast<LocalVector<Face3> *>(p_userdata);
+	const GodotFaceShape3D *face = static_cast<const GodotFaceShape3D *>(p_convex);
+	faces->push_back(Face3(face->vertex[0], face->vertex[1], face->vertex[2]));
+	return false;
+}
+
+static bool _has_face(const LocalVector<Face3> &p_faces, const Face3 &p_face) {
+	for (const Face3 &face : p_faces) {
+		if (face.vertex[0].is_equal_approx(p_face.vertex[0]) && face.vertex[1].is_equal_approx(p_face.vertex[1]) && face.vertex[2].is_equal_approx(p_face.vertex[2])) {
+			return true;
+		}
+	}
+	return false;
+}
+
+TEST_CASE("[GodotPhysics3D] Height map shape queries") {
+	const int width = 129;
+	const int depth = 97;
+
+	// Two flat terraces at heights 0 and 10, with a slope in between.
+	Vector<real_t> heights;
+	heights.resize(width * depth);
+	for (int z = 0; z < depth; z++) {
+		for (int x = 0; x < width; x++) {
+			heights.write[z * width + x] = CLAMP(x - 60, 0, 10);
+		}
+	}
+
+	GodotHeightMapShape3D *shape = memnew(GodotHeightMapShape3D);
+	Dictionary d;
+	d["width"] = width;
+	d["depth"] = depth;
+	d["heights"] = heights;
+	shape->set_data(d);
+
+	const Vector3 origin = Vector3((width - 1) * 0.5, 0, (depth - 1) * 0.5);
+	const AABB shape_aabb = shape->get_aabb();
+	CHECK(shape_aabb.position.is_equal_approx(Vector3(-origin.x, 0, -origin.z)));
+	CHECK(shape_aabb.size.is_equal_approx(Vector3(width - 1, 10, depth - 1)));
+
+	SUBCASE("Ray casts hit the surface") {
+		Vector3 point;
+		Vector3 normal;
+		int face_index = -1;
+		for (int i = 0; i < 16; i++) {
+			const real_t x = i * 8.0 + 0.5;
+			const real_t z = i * 6.0 + 0.25;
+			const Vector3 begin = Vector3(x, 50, z) - origin;
+			const Vector3 end = Vector3(x, -50, z) - origin;
+			REQUIRE(shape->intersect_segment(begin, end, point, normal, face_index, false));
+			CHECK(point.y == doctest::Approx(CLAMP(x - 60, 0, 10)));
+		}
+
+		// Rays passing above the terraces don't hit anything.
+		CHECK_FALSE(shape->intersect_segment(Vector3(-origin.x, 11, 0), Vector3(origin.x, 11, 0), point, normal, face_index, false));
+		CHECK_FALSE(shape->intersect_segment(Vector3(-origin.x, 1, 0), Vector3(-4, 1, 0), point, normal, face_index, false));
+		CHECK(shape->intersect_segment(Vector3(-origin.x, 1, 0.5), Vector3(origin.x, 1, 0.5), point, normal, face_index, false));
+		CHECK(point.x == doctest::Approx(61 - origin.x));
+	}
+
+	SUBCASE("Culling returns every overlapping face") {
+		const AABB queries[] = {
+			AABB(Vector3(-40, -1, -20), Vector3(10, 2, 8)),
+			AABB(Vector3(-5, 4, -30), Vector3(20, 1, 60)),
+			AABB(Vector3(10, 9.5, 0), Vector3(30, 1, 30)),
+			AABB(Vector3(-70, -5, -50), Vector3(140, 20, 100)),
+		};
+
+		for (const AABB &query : queries) {
+			LocalVector<Face3> culled;
+			shape->cull(query, _collect_faces, &culled, false);
+
+			int expected = 0;
+			for (int z = 0; z < depth - 1; z++) {
+				for (int x = 0; x < width - 1; x++) {
+					const Vector3 p00 = Vector3(x, heights[z * width + x], z) - origin;
+					const Vector3 p10 = Vector3(x + 1, heights[z * width + x + 1], z) - origin;
+					const Vector3 p01 = Vector3(x, heights[(z + 1) * width + x], z + 1) - origin;
+					const Vector3 p11 = Vector3(x + 1, heights[(z + 1) * width + x + 1], z + 1) - origin;
+					const Face3 faces[2] = { Face3(p00, p10, p01), Face3(p10, p11, p01) };
+					for (const Face3 &face : faces) {
+						if (face.get_aabb().intersects(query)) {
+							CHECK(_has_face(culled, face));
+							expected++;
+						}
+					}
+				}
+			}
+			CHECK(expected > 0);
+			CHECK(culled.size() >= (uint32_t)expected);
+		}
+
+		// Nothing is above the upper terrace.
+		LocalVector<Face3> culled;
+		shape->cull(AABB(Vector3(-origin.x, 12, -origin.z), Vector3(width, 5, depth)), _collect_faces, &culled, false);
+		CHECK(culled.is_empty());
+	}
+
+	memdelete(shape);
+}
+
+TEST_CASE("[GodotPhysics3D] Concave polygon shape prebuilt BVH") {
+	Vector<Vector3> faces;
+	const int size = 24;
+	for (int z = 0; z < size; z++) {
+		for (int x = 0; x < size; x++) {
+			const Vector3 p(x, Math::sin(x * 0.5) * Math::cos(z * 0.5), z);
+			faces.push_back(p);
+			faces.push_back(p + Vector3(1, 0, 0));
+			faces.push_back(p + Vector3(0, 0, 1));
+		}
+	}
+
+	GodotConcavePolygonShape3D *source = memnew(GodotConcavePolygonShape3D);
+	Dictionary d;
+	d["faces"] = faces;
+	d["backface_collision"] = true;
+	source->set_data(d);
+
+	// The BVH is only serialized when requested.
+	CHECK_FALSE(Dictionary(source->get_data()).has("bvh"));
+	d["store_bvh"] = true;
+	source->set_data(d);
+
+	Dictionary saved = source->get_data();
+	const Vector<uint8_t> bvh = saved["bvh"];
+	CHECK_FALSE(bvh.is_empty());
+
+	// Loading the saved BVH gives the same results as building it.
+	GodotConcavePolygonShape3D *loaded = memnew(GodotConcavePolygonShape3D);
+	loaded->set_data(saved);
+	CHECK(loaded->get_aabb() == source->get_aabb());
+	CHECK(Vector<uint8_t>(Dictionary(loaded->get_data())["bvh"]) == bvh);
+
+	for (int i = 0; i < size; i++) {
+		const Vector3 begin(i + 0.3, 5, size - i - 0.7);
+		const Vector3 end(i + 0.3, -5, size - i - 0.7);
+		Vector3 source_point, source_normal;
+		Vector3 loaded_point, loaded_normal;
+		int source_face = -1;
+		int loaded_face = -1;
+		const bool source_hit = source->intersect_segment(begin, end, source_point, source_normal, source_face, true);
+		const bool loaded_hit = loaded->intersect_segment(begin, end, loaded_point, loaded_normal, loaded_face, true);
+		CHECK(source_hit == loaded_hit);
+		CHECK(source_point.is_equal_approx(loaded_point));
+		CHECK(source_face == loaded_face);
+	}
+
+	// A BVH that doesn't match the faces is ignored and rebuilt.
+	Vector<Vector3> moved_faces = faces;
+	for (int i = 0; i < moved_faces.size(); i++) {
+		moved_faces.write[i].y += 10;
+	}
+	Dictionary mismatched;
+	mismatched["faces"] = moved_faces;
+	mismatched["backface_collision"] = true;
+	mismatched["bvh"] = bvh;
+	loaded->set_data(mismatched);
+	CHECK(loaded->get_aabb().position.y == doctest::Approx(source->get_aabb().position.y + 10));
+
+	Vector3 point, normal;
+	int face_index = -1;
+	CHECK(loaded->intersect_segment(Vector3(0.3, 20, 0.3), Vector3(0.3, 0, 0.3), point, normal, face_index, true));
+	CHECK(point.y > 9);
+
+	// Corrupted data is rejected as well.
+	Vector<uint8_t> corrupted = bvh;
+	corrupted.resize(corrupted.size() / 2);
+	d["bvh"] = corrupted;
+	loaded->set_data(d);
+	CHECK(loaded->intersect_segment(Vector3(0.3, 20, 0.3), Vector3(0.3, -20, 0.3), point, normal, face_index, true));
+
+	memdelete(loaded);
+	memdelete(source);
+}
+
+} // namespace TestGodotShape3D
+
+#endif // TEST_GODOT_SHAPE_3D_H
@@ -0,0 +1,142 @@
+/**************************************************************************/
+/*  test_godot_soft_body_3d.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#ifndef TEST_GODOT_SOFT_BODY_3D_H
+#define TEST_GODOT_SOFT_BODY_3D_H
+
+#include "../godot_area_3d.h"
+#include "../godot_physics_server_3d.h"
+#include "../godot_soft_body_3d.h"
+#include "../godot_space_3d.h"
+
+#include "servers/rendering_server.h"
+#include "tests/test_macros.h"
+
+namespace TestGodotSoftBody3D {
+
+// Cloth made of a grid of `p_size` by `p_size` vertices, large enough to have its links solved in batches.
+static RID create_cloth_mesh(int p_size) {
+	PackedVector3Array vertices;
+	for (int z = 0; z < p_size; z++) {
+		for (int x = 0; x < p_size; x++) {
+			vertices.push_back(Vector3(x * 0.1, 0, z * 0.1));
+		}
+	}
+
+	PackedInt32Array indices;
+	for (int z = 0; z < p_size - 1; z++) {
+		for (int x = 0; x < p_size - 1; x++) {
+			const int i = z * p_size + x;
+			indices.push_back(i);
+			indices.push_back(i + 1);
+			indices.push_back(i + p_size);
+			indices.push_back(i + 1);
+			indices.push_back(i + p_size + 1);
+			indices.push_back(i + p_size);
+		}
+	}
+
+	Array arrays;
+	arrays.resize(RS::ARRAY_MAX);
+	arrays[RS::ARRAY_VERTEX] = vertices;
+	arrays[RS::ARRAY_INDEX] = indices;
+
+	RID mesh = RS::get_singleton()->mesh_create();
+	RS::get_singleton()->mesh_add_surface_from_arrays(mesh, RS::PRIMITIVE_TRIANGLES, arrays);
+	return mesh;
+}
+
+// Soft bodies are created from meshes, and the RenderingServer is only available in "[SceneTree]" tests.
+// These also create the default physics server (GodotPhysics3D), which soft bodies need for their shape updates.
+TEST_CASE("[SceneTree][GodotPhysics3D] Soft body links give the same result with and without threads") {
+	REQUIRE(PhysicsServer3D::get_singleton());
+
+	GodotSpace3D *space = memnew(GodotSpace3D);
+	GodotArea3D *default_area = memnew(GodotArea3D);
+	space->set_default_area(default_area);
+	default_area->set_space(space);
+	default_area->set_priority(-1);
+
+	const int size = 80;
+	RID mesh = create_cloth_mesh(size);
+
+	GodotSoftBody3D *serial_body = memnew(GodotSoftBody3D);
+	GodotSoftBody3D *threaded_body = memnew(GodotSoftBody3D);
+	for (GodotSoftBody3D *body : { serial_body, threaded_body }) {
+		body->set_space(space);
+		body->set_mesh(mesh);
+		// Pin one edge so the cloth hangs and its links get stretched.
+		for (int x = 0; x < size; x++) {
+			body->pin_vertex(x);
+		}
+	}
+	REQUIRE(serial_body->has_link_batches());
+	REQUIRE(threaded_body->has_link_batches());
+
+	const real_t step = 1.0 / 60.0;
+	for (int i = 0; i < 30; i++) {
+		for (GodotSoftBody3D *body : { serial_body, threaded_body }) {
+			body->predict_motion(step);
+			body->update_shape_bounds();
+		}
+		serial_body->solve_constraints(step, false);
+		threaded_body->solve_constraints(step, true);
+	}
+
+	const uint32_t node_count = serial_body->get_node_count();
+	REQUIRE(node_count == threaded_body->get_node_count());
+
+	real_t lowest = 0.0;
+	uint32_t mismatches = 0;
+	for (uint32_t i = 0; i < node_count; i++) {
+		const Vector3 position = serial_body->get_node_position(i);
+		lowest = MIN(lowest, position.y);
+		if (!position.is_equal_approx(threaded_body->get_node_position(i))) {
+			mismatches++;
+		}
+	}
+	CHECK_MESSAGE(lowest < -0.1, "The cloth should have fallen.");
+	CHECK_MESSAGE(mismatches == 0, "Solving links on multiple threads should not change the result.");
+
+	for (GodotSoftBody3D *body : { serial_body, threaded_body }) {
+		body->set_space(nullptr);
+		memdelete(body);
+	}
+	RS::get_singleton()->free(mesh);
+
+	default_area->set_space(nullptr);
+	memdelete(default_area);
+	memdelete(space);
+}
+
+} // namespace TestGodotSoftBody3D
+
+#endif // TEST_GODOT_SOFT_BODY_3D_H
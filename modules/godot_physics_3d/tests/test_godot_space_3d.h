@@ -0,0 +1,330 @@
+/**************************************************************************/
+/*  test_godot_space_3d.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_GODOT_SPACE_3D_H
+#define TEST_GODOT_SPACE_3D_H
+
+#include "../godot_physics_server_3d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGodotSpace3D {
+
+TEST_CASE("[GodotPhysics3D] Space state save and restore") {
+	GodotPhysicsServer3D *server = memnew(GodotPhysicsServer3D);
+	server->init();
+
+	RID space = server->space_create();
+	server->space_set_active(space, true);
+
+	RID floor_shape = server->box_shape_create();
+	server->shape_set_data(floor_shape, Vector3(10, 1, 10));
+	RID floor = server->body_create();
+	server->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+	server->body_add_shape(floor, floor_shape);
+	server->body_set_space(floor, space);
+
+	RID box_shape = server->box_shape_create();
+	server->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+	LocalVector<RID> boxes;
+	for (int i = 0; i < 8; i++) {
+		RID box = server->body_create();
+		server->body_add_shape(box, box_shape);
+		server->body_set_space(box, space);
+		server->body_set_state(box, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(i * 1.5 - 5.0, 2.0 + i * 0.25, 0)));
+		boxes.push_back(box);
+	}
+
+	const real_t step = 1.0 / 60.0;
+	for (int i = 0; i < 30; i++) {
+		server->step(step);
+	}
+
+	const Vector<uint8_t> state = server->space_save_state(space);
+	CHECK_FALSE(state.is_empty());
+
+	LocalVector<Transform3D> saved_transforms;
+	for (const RID &box : boxes) {
+		saved_transforms.push_back(server->body_get_state(box, PhysicsServer3D::BODY_STATE_TRANSFORM));
+	}
+
+	for (int i = 0; i < 30; i++) {
+		server->step(step);
+	}
+
+	LocalVector<Transform3D> expected_transforms;
+	LocalVector<Vector3> expected_velocities;
+	for (const RID &box : boxes) {
+		expected_transforms.push_back(server->body_get_state(box, PhysicsServer3D::BODY_STATE_TRANSFORM));
+		expected_velocities.push_back(server->body_get_state(box, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY));
+	}
+
+	SUBCASE("Restoring puts the bodies back and replays the same simulation") {
+		CHECK(server->space_restore_state(space, state) == OK);
+
+		for (uint32_t i = 0; i < boxes.size(); i++) {
+			const Transform3D transform = server->body_get_state(boxes[i], PhysicsServer3D::BODY_STATE_TRANSFORM);
+			CHECK(transform.is_equal_approx(saved_transforms[i]));
+		}
+
+		for (int i = 0; i < 30; i++) {
+			server->step(step);
+		}
+
+		for (uint32_t i = 0; i < boxes.size(); i++) {
+			const Transform3D transform = server->body_get_state(boxes[i], PhysicsServer3D::BODY_STATE_TRANSFORM);
+			const Vector3 velocity = server->body_get_state(boxes[i], PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY);
+			CHECK(transform.is_equal_approx(expected_transforms[i]));
+			CHECK(velocity.is_equal_approx(expected_velocities[i]));
+		}
+	}
+
+	SUBCASE("Restoring ignores bodies that were removed from the space") {
+		server->free(boxes[0]);
+		boxes.remove_at(0);
+		CHECK(server->space_restore_state(space, state) == OK);
+		const Transform3D transform = server->body_get_state(boxes[0], PhysicsServer3D::BODY_STATE_TRANSFORM);
+		CHECK(transform.is_equal_approx(saved_transforms[1]));
+	}
+
+	SUBCASE("Invalid states are rejected") {
+		ERR_PRINT_OFF;
+		CHECK(server->space_restore_state(space, Vector<uint8_t>()) == ERR_INVALID_DATA);
+		Vector<uint8_t> truncated = state;
+		truncated.resize(state.size() - 1);
+		CHECK(server->space_restore_state(space, truncated) == ERR_INVALID_DATA);
+		Vector<uint8_t> corrupted = state;
+		corrupted.write[0] ^= 0xff;
+		CHECK(server->space_restore_state(space, corrupted) == ERR_FILE_UNRECOGNIZED);
+		ERR_PRINT_ON;
+	}
+
+	for (const RID &box : boxes) {
+		server->free(box);
+	}
+	server->free(box_shape);
+	server->free(floor);
+	server->free(floor_shape);
+	server->free(space);
+
+	server->finish();
+	memdelete(server);
+}
+
+TEST_CASE("[GodotPhysics3D] Batched motion tests") {
+	GodotPhysicsServer3D *server = memnew(GodotPhysicsServer3D);
+	server->init();
+
+	RID space = server->space_create();
+	server->space_set_active(space, true);
+
+	RID wall_shape = server->box_shape_create();
+	server->shape_set_data(wall_shape, Vector3(0.5, 10, 50));
+	RID wall = server->body_create();
+	server->body_set_mode(wall, PhysicsServer3D::BODY_MODE_STATIC);
+	server->body_add_shape(wall, wall_shape);
+	server->body_set_space(wall, space);
+	server->body_set_state(wall, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(10, 0, 0)));
+
+	RID character_shape = server->sphere_shape_create();
+	server->shape_set_data(character_shape, 0.5);
+
+	// Characters are spread along the wall, every other one moves towards it.
+	const int count = 64;
+	LocalVector<RID> characters;
+	LocalVector<PhysicsServer3D::MotionParameters> parameters;
+	for (int i = 0; i < count; i++) {
+		RID character = server->body_create();
+		server->body_set_mode(character, PhysicsServer3D::BODY_MODE_KINEMATIC);
+		server->body_add_shape(character, character_shape);
+		server->body_set_space(character, space);
+		const Transform3D transform(Basis(), Vector3(0, 0, i - count * 0.5));
+		server->body_set_state(character, PhysicsServer3D::BODY_STATE_TRANSFORM, transform);
+		characters.push_back(character);
+		parameters.push_back(PhysicsServer3D::MotionParameters(transform, Vector3(i % 2 ? 20 : -20, 0, 0)));
+	}
+
+	LocalVector<PhysicsServer3D::MotionResult> results;
+	LocalVector<bool> collided;
+	results.resize(count);
+	collided.resize(count);
+	server->body_test_motion_batch(characters.ptr(), parameters.ptr(), results.ptr(), collided.ptr(), count);
+
+	for (int i = 0; i < count; i++) {
+		PhysicsServer3D::MotionResult expected;
+		const bool expected_collided = server->body_test_motion(characters[i], parameters[i], &expected);
+		CHECK(collided[i] == expected_collided);
+		CHECK(collided[i] == (i % 2 == 1));
+		CHECK(results[i].travel.is_equal_approx(expected.travel));
+		CHECK(results[i].collision_count == expected.collision_count);
+		if (collided[i]) {
+			CHECK(results[i].collisions[0].collider == wall);
+			CHECK(results[i].travel.x == doctest::Approx(9).epsilon(0.01));
+		}
+	}
+
+	for (const RID &character : characters) {
+		server->free(character);
+	}
+	server->free(character_shape);
+	server->free(wall);
+	server->free(wall_shape);
+	server->free(space);
+
+	server->finish();
+	memdelete(server);
+}
+
+TEST_CASE("[GodotPhysics3D] Continuous collision detection with thin walls") {
+	GodotPhysicsServer3D *server = memnew(GodotPhysicsServer3D);
+	server->init();
+
+	RID space = server->space_create();
+	server->space_set_active(space, true);
+
+	// A 10 cm thick wall, much thinner than the distance travelled by the projectiles in one step.
+	RID wall_shape = server->box_shape_create();
+	server->shape_set_data(wall_shape, Vector3(0.05, 1, 1));
+	RID wall = server->body_create();
+	server->body_set_mode(wall, PhysicsServer3D::BODY_MODE_STATIC);
+	server->body_add_shape(wall, wall_shape);
+	server->body_set_space(wall, space);
+	server->body_set_state(wall, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(10, 0, 0)));
+
+	RID projectile_shape = server->sphere_shape_create();
+	server->shape_set_data(projectile_shape, 0.25);
+
+	// Returns the velocity of the projectile at the end, and how far it went.
+	auto shoot = [&](const Vector3 &p_from, bool p_continuous_cd, real_t &r_max_x) -> Vector3 {
+		RID projectile = server->body_create();
+		server->body_add_shape(projectile, projectile_shape);
+		server->body_set_param(projectile, PhysicsServer3D::BODY_PARAM_GRAVITY_SCALE, 0.0);
+		server->body_set_enable_continuous_collision_detection(projectile, p_continuous_cd);
+		server->body_set_space(projectile, space);
+		server->body_set_state(projectile, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), p_from));
+		server->body_set_state(projectile, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, Vector3(290, 0, 0));
+
+		r_max_x = p_from.x;
+		for (int i = 0; i < 10; i++) {
+			server->step(1.0 / 60.0);
+			const Transform3D transform = server->body_get_state(projectile, PhysicsServer3D::BODY_STATE_TRANSFORM);
+			r_max_x = MAX(r_max_x, transform.origin.x);
+		}
+
+		const Vector3 velocity = server->body_get_state(projectile, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY);
+		server->free(projectile);
+		return velocity;
+	};
+
+	real_t max_x = 0.0;
+
+	// Without CCD, the projectile is never overlapping the wall at the end of a step.
+	Vector3 velocity = shoot(Vector3(), false, max_x);
+	CHECK(max_x > 10.5);
+	CHECK(velocity.is_equal_approx(Vector3(290, 0, 0)));
+
+	velocity = shoot(Vector3(), true, max_x);
+	CHECK(max_x < 10.0);
+	CHECK(velocity.x < 1.0);
+
+	// Only the side of the projectile hits the edge of the wall, so no ray cast from its front does.
+	// It may slide around the edge, but it must be deflected.
+	velocity = shoot(Vector3(0, 0, 1.15), true, max_x);
+	CHECK(velocity.x < 200.0);
+
+	server->free(projectile_shape);
+	server->free(wall);
+	server->free(wall_shape);
+	server->free(space);
+
+	server->finish();
+	memdelete(server);
+}
+
+TEST_CASE("[GodotPhysics3D] Stacked bodies are simulated deterministically") {
+	GodotPhysicsServer3D *server = memnew(GodotPhysicsServer3D);
+	server->init();
+
+	RID floor_shape = server->box_shape_create();
+	server->shape_set_data(floor_shape, Vector3(10, 1, 10));
+	RID box_shape = server->box_shape_create();
+	server->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+
+	// The same stack in two spaces, both stepped with the islands solved on the thread pool.
+	LocalVector<RID> spaces;
+	LocalVector<RID> bodies[2];
+	for (int s = 0; s < 2; s++) {
+		RID space = server->space_create();
+		server->space_set_active(space, true);
+		spaces.push_back(space);
+
+		RID floor = server->body_create();
+		server->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+		server->body_add_shape(floor, floor_shape);
+		server->body_set_space(floor, space);
+		bodies[s].push_back(floor);
+
+		for (int i = 0; i < 10; i++) {
+			RID box = server->body_create();
+			server->body_add_shape(box, box_shape);
+			server->body_set_space(box, space);
+			// Slightly offset, so the stack doesn't stay perfectly symmetric.
+			server->body_set_state(box, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(i * 0.05, 1.6 + i * 1.05, 0)));
+			bodies[s].push_back(box);
+		}
+	}
+
+	const real_t step = 1.0 / 60.0;
+	for (int i = 0; i < 120; i++) {
+		server->step(step);
+	}
+
+	for (uint32_t i = 1; i < bodies[0].size(); i++) {
+		const Transform3D first = server->body_get_state(bodies[0][i], PhysicsServer3D::BODY_STATE_TRANSFORM);
+		const Transform3D second = server->body_get_state(bodies[1][i], PhysicsServer3D::BODY_STATE_TRANSFORM);
+		CHECK(first.is_equal_approx(second));
+	}
+
+	for (int s = 0; s < 2; s++) {
+		for (const RID &body : bodies[s]) {
+			server->free(body);
+		}
+		server->free(spaces[s]);
+	}
+	server->free(box_shape);
+	server->free(floor_shape);
+
+	server->finish();
+	memdelete(server);
+}
+
+} // namespace TestGodotSpace3D
+
+#endif // TEST_GODOT_SPACE_3D_H
@@ -267,6 +267,20 @@ int JoltPhysicsServer3D::space_get_contact_count(RID p_space) const {
 #endif
 }
 
+Vector<uint8_t> JoltPhysicsServer3D::space_save_state(RID p_space) const {
+	const JoltSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, Vector<uint8_t>());
+
+	return space->save_state();
+}
+
+Error JoltPhysicsServer3D::space_restore_state(RID p_space, const Vector<uint8_t> &p_state) {
+	JoltSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, ERR_INVALID_PARAMETER);
+
+	return space->restore_state(p_state);
+}
+
 RID JoltPhysicsServer3D::area_create() {
 	JoltArea3D *area = memnew(JoltArea3D);
 	RID rid = area_owner.make_rid(area);
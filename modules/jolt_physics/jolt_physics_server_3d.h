@@ -163,6 +163,9 @@ public:
 	virtual PackedVector3Array space_get_contacts(RID p_space) const override;
 	virtual int space_get_contact_count(RID p_space) const override;
 
+	virtual Vector<uint8_t> space_save_state(RID p_space) const override;
+	virtual Error space_restore_state(RID p_space, const Vector<uint8_t> &p_state) override;
+
 	virtual RID area_create() override;
 
 	virtual void area_set_space(RID p_area, RID p_space) override;
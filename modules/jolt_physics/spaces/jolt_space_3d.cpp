@@ -49,6 +49,7 @@
 #include "core/variant/variant_utility.h"
 
 #include "Jolt/Physics/PhysicsScene.h"
+#include "Jolt/Physics/StateRecorder.h"
 
 namespace {
 
@@ -60,6 +61,39 @@ constexpr double DEFAULT_SLEEP_THRESHOLD_LINEAR = 0.1;
 constexpr double DEFAULT_SLEEP_THRESHOLD_ANGULAR = 8.0 * Math_PI / 180;
 constexpr double DEFAULT_SOLVER_ITERATIONS = 8;
 
+class JoltStateRecorder3D final : public JPH::StateRecorder {
+	Vector<uint8_t> data;
+	int64_t read_position = 0;
+	bool failed = false;
+
+public:
+	JoltStateRecorder3D() = default;
+	explicit JoltStateRecorder3D(const Vector<uint8_t> &p_data) :
+			data(p_data) {}
+
+	const Vector<uint8_t> &get_data() const { return data; }
+
+	virtual void WriteBytes(const void *p_data, size_t p_bytes) override {
+		const int64_t position = data.size();
+		data.resize(position + (int64_t)p_bytes);
+		memcpy(data.ptrw() + position, p_data, p_bytes);
+	}
+
+	virtual void ReadBytes(void *p_data, size_t p_bytes) override {
+		if (read_position + (int64_t)p_bytes > data.size()) {
+			failed = true;
+			memset(p_data, 0, p_bytes);
+			return;
+		}
+
+		memcpy(p_data, data.ptr() + read_position, p_bytes);
+		read_position += (int64_t)p_bytes;
+	}
+
+	virtual bool IsEOF() const override { return read_position >= data.size(); }
+	virtual bool IsFailed() const override { return failed; }
+};
+
 } // namespace
 
 void JoltSpace3D::_pre_step(float p_step) {
@@ -451,6 +485,22 @@ void JoltSpace3D::dequeue_needs_optimization(SelfList<JoltShapedObject3D> *p_obj
 	}
 }
 
+Vector<uint8_t> JoltSpace3D::save_state() const {
+	JoltStateRecorder3D recorder;
+	physics_system->SaveState(recorder);
+	return recorder.get_data();
+}
+
+Error JoltSpace3D::restore_state(const Vector<uint8_t> &p_state) {
+	ERR_FAIL_COND_V_MSG(stepping, ERR_LOCKED, "Space state can't be restored while the space is being stepped.");
+
+	JoltStateRecorder3D recorder(p_state);
+	const bool restored = physics_system->RestoreState(recorder);
+	ERR_FAIL_COND_V_MSG(!restored || recorder.IsFailed(), ERR_INVALID_DATA, vformat("Failed to restore state of physics space with RID '%d'. The bodies in the space must be the same as when the state was saved.", rid.get_id()));
+
+	return OK;
+}
+
 void JoltSpace3D::add_joint(JPH::Constraint *p_jolt_ref) {
 	physics_system->AddConstraint(p_jolt_ref);
 }
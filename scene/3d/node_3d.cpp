@@ -108,6 +108,15 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
+	// If the global transform was already invalidated and no node left the list of pending transform notifications or
+	// entered the tree since then, there is no need to walk the subtree again: computing the global transform of any descendant
+	// would have cleared this node too, so they are all still dirty, and the ones that need it are still waiting for a notification.
+	const bool group_processing = is_group_processing();
+	const uint64_t pass = get_tree()->xform_change_pass.get();
+	if (!group_processing && this != p_origin && data.xform_change_pass == pass && _test_dirty_bits(DIRTY_GLOBAL_TRANSFORM)) {
+		return;
+	}
+
 	for (Node3D *&E : data.children) {
 		if (E->data.top_level) {
 			continue; //don't propagate to a top_level
@@ -127,6 +136,17 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		}
 	}
 	_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM);
+	if (!group_processing) {
+		data.xform_change_pass = pass;
+	}
+}
+
+void Node3D::_invalidate_transform_propagation() {
+	// Called when a node may need a transform notification it wasn't queued for,
+	// so the next changes must reach it even if its ancestors are already dirty.
+	if (is_inside_tree()) {
+		get_tree()->xform_change_pass.increment();
+	}
 }
 
 void Node3D::_notification(int p_what) {
@@ -159,6 +179,8 @@ void Node3D::_notification(int p_what) {
 
 			_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM); // Global is always dirty upon entering a scene.
 			_notify_dirty();
+			// The new parent may already be marked as visited in the current pass, without this node having been reached.
+			_invalidate_transform_propagation();
 
 			notification(NOTIFICATION_ENTER_WORLD);
 			_update_visibility_parent(true);
@@ -732,6 +754,7 @@ void Node3D::add_gizmo(Ref<Node3DGizmo> p_gizmo) {
 		return;
 	}
 	data.gizmos.push_back(p_gizmo);
+	_invalidate_transform_propagation();
 
 	if (p_gizmo.is_valid() && is_inside_world()) {
 		p_gizmo->create();
@@ -1086,6 +1109,9 @@ Vector3 Node3D::to_global(Vector3 p_local) const {
 
 void Node3D::set_notify_transform(bool p_enabled) {
 	ERR_THREAD_GUARD;
+	if (p_enabled && !data.notify_transform) {
+		_invalidate_transform_propagation();
+	}
 	data.notify_transform = p_enabled;
 }
 
@@ -1111,6 +1137,7 @@ void Node3D::force_update_transform() {
 		return; //nothing to update
 	}
 	get_tree()->xform_change_list.remove(&xform_change);
+	get_tree()->xform_change_pass.increment();
 
 	notification(NOTIFICATION_TRANSFORM_CHANGED);
 }
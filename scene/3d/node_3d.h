@@ -129,6 +129,8 @@ private:
 		List<Node3D *> children;
 		List<Node3D *>::Element *C = nullptr;
 
+		uint64_t xform_change_pass = 0; // Last time the global transform was invalidated, see _propagate_transform_changed().
+
 		ClientPhysicsInterpolationData *client_physics_interpolation_data = nullptr;
 
 #ifdef TOOLS_ENABLED
@@ -151,6 +153,7 @@ private:
 	void _update_gizmos();
 	void _notify_dirty();
 	void _propagate_transform_changed(Node3D *p_origin);
+	void _invalidate_transform_propagation();
 
 	void _propagate_visibility_changed();
 
@@ -159,7 +162,12 @@ private:
 	void _propagate_transform_changed_deferred();
 
 protected:
-	_FORCE_INLINE_ void set_ignore_transform_notification(bool p_ignore) { data.ignore_notification = p_ignore; }
+	_FORCE_INLINE_ void set_ignore_transform_notification(bool p_ignore) {
+		if (!p_ignore && data.ignore_notification) {
+			_invalidate_transform_propagation();
+		}
+		data.ignore_notification = p_ignore;
+	}
 
 	_FORCE_INLINE_ void _update_local_transform() const;
 	_FORCE_INLINE_ void _update_rotation_and_scale() const;
@@ -50,14 +50,25 @@ void VisualInstance3D::_update_visibility() {
 	// If making visible, make sure the rendering server is up to date with the transform.
 	if (visible && !already_visible) {
 		if (!_is_using_identity_transform()) {
-			Transform3D gt = get_global_transform();
-			RS::get_singleton()->instance_set_transform(instance, gt);
+			_set_instance_transform(get_global_transform());
 		}
 	}
 
 	RS::get_singleton()->instance_set_visible(instance, visible);
 }
 
+void VisualInstance3D::_set_instance_transform(const Transform3D &p_transform) {
+	// An older transform may still be waiting in the batch, make sure it won't override this one.
+	_cancel_pending_instance_transform();
+	RS::get_singleton()->instance_set_transform(instance, p_transform);
+}
+
+void VisualInstance3D::_cancel_pending_instance_transform() {
+	if (pending_transform_version != 0 && is_inside_tree()) {
+		get_tree()->_cancel_instance_transform(pending_transform_version, pending_transform_index);
+	}
+}
+
 void VisualInstance3D::_physics_interpolated_changed() {
 	RenderingServer::get_singleton()->instance_set_interpolated(instance, is_physics_interpolated());
 }
@@ -69,10 +80,10 @@ void VisualInstance3D::set_instance_use_identity_transform(bool p_enable) {
 	if (is_inside_tree()) {
 		if (p_enable) {
 			// Want to make sure instance is using identity transform.
-			RS::get_singleton()->instance_set_transform(instance, Transform3D());
+			_set_instance_transform(Transform3D());
 		} else {
 			// Want to make sure instance is up to date.
-			RS::get_singleton()->instance_set_transform(instance, get_global_transform());
+			_set_instance_transform(get_global_transform());
 		}
 	}
 }
@@ -88,7 +99,11 @@ void VisualInstance3D::_notification(int p_what) {
 		case NOTIFICATION_TRANSFORM_CHANGED: {
 			if (_is_vi_visible() || is_physics_interpolated_and_enabled()) {
 				if (!_is_using_identity_transform()) {
-					RenderingServer::get_singleton()->instance_set_transform(instance, get_global_transform());
+					// Transforms sent while the tree flushes transform notifications are batched into a single call.
+					// Interpolated instances are left out, their transform must reach the server before any reset.
+					if (!is_inside_tree() || is_physics_interpolated_and_enabled() || !get_tree()->_queue_instance_transform(instance, get_global_transform(), pending_transform_version, pending_transform_index)) {
+						_set_instance_transform(get_global_transform());
+					}
 
 					// For instance when first adding to the tree, when the previous transform is
 					// unset, to prevent streaking from the origin.
@@ -108,7 +123,7 @@ void VisualInstance3D::_notification(int p_what) {
 				// This is because NOTIFICATION_TRANSFORM_CHANGED is deferred,
 				// and cannot be relied to be called in order before NOTIFICATION_RESET_PHYSICS_INTERPOLATION.
 				if (!_is_using_identity_transform()) {
-					RenderingServer::get_singleton()->instance_set_transform(instance, get_global_transform());
+					_set_instance_transform(get_global_transform());
 				}
 
 				RenderingServer::get_singleton()->instance_reset_physics_interpolation(instance);
@@ -116,6 +131,7 @@ void VisualInstance3D::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_EXIT_WORLD: {
+			_cancel_pending_instance_transform();
 			RenderingServer::get_singleton()->instance_set_scenario(instance, RID());
 			RenderingServer::get_singleton()->instance_attach_skeleton(instance, RID());
 			_set_vi_visible(false);
@@ -42,6 +42,13 @@ class VisualInstance3D : public Node3D {
 	float sorting_offset = 0.0;
 	bool sorting_use_aabb_center = true;
 
+	// Entry of this instance in the SceneTree transform batch, if any.
+	uint64_t pending_transform_version = 0;
+	uint32_t pending_transform_index = 0;
+
+	void _set_instance_transform(const Transform3D &p_transform);
+	void _cancel_pending_instance_transform();
+
 protected:
 	void _update_visibility();
 
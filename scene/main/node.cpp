@@ -76,20 +76,16 @@ void Node::_notification(int p_notification) {
 				data.process_owner = this;
 			}
 
-			{ // Update threaded process mode.
-				if (data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT) {
-					if (data.parent) {
-						data.process_thread_group_owner = data.parent->data.process_thread_group_owner;
-					}
+			data.process_callback = _get_process_callback();
 
+			{ // Update threaded process mode.
+				_update_process_thread_group_owner();
+				if (!_owns_process_thread_group()) {
 					if (data.process_thread_group_owner) {
 						data.process_group = data.process_thread_group_owner->data.process_group;
 					} else {
 						data.process_group = &data.tree->default_process_group;
 					}
-				} else {
-					data.process_thread_group_owner = this;
-					_add_process_group();
 				}
 
 				if (_is_any_processing()) {
@@ -178,12 +174,17 @@ void Node::_notification(int p_notification) {
 				_remove_process_group();
 			}
 			data.process_thread_group_owner = nullptr;
+			data.process_thread_group_auto = false;
 			data.process_owner = nullptr;
 
 			if (data.path_cache) {
 				memdelete(data.path_cache);
 				data.path_cache = nullptr;
 			}
+			if (data.resolved_paths) {
+				memdelete(data.resolved_paths);
+				data.resolved_paths = nullptr;
+			}
 		} break;
 
 		case NOTIFICATION_SUSPENDED:
@@ -1048,7 +1049,7 @@ void Node::_remove_tree_from_process_thread_group() {
 	}
 
 	for (KeyValue<StringName, Node *> &K : data.children) {
-		if (K.value->data.process_thread_group != PROCESS_THREAD_GROUP_INHERIT) {
+		if (K.value->_owns_process_thread_group()) {
 			continue;
 		}
 
@@ -1061,10 +1062,6 @@ void Node::_remove_tree_from_process_thread_group() {
 }
 
 void Node::_add_tree_to_process_thread_group(Node *p_owner) {
-	if (_is_any_processing()) {
-		_add_to_process_thread_group();
-	}
-
 	data.process_thread_group_owner = p_owner;
 	if (p_owner != nullptr) {
 		data.process_group = p_owner->data.process_group;
@@ -1072,12 +1069,29 @@ void Node::_add_tree_to_process_thread_group(Node *p_owner) {
 		data.process_group = &data.tree->default_process_group;
 	}
 
+	if (_is_any_processing()) {
+		_add_to_process_thread_group();
+	}
+
 	for (KeyValue<StringName, Node *> &K : data.children) {
-		if (K.value->data.process_thread_group != PROCESS_THREAD_GROUP_INHERIT) {
+		if (K.value->_owns_process_thread_group()) {
 			continue;
 		}
 
-		K.value->_add_to_process_thread_group();
+		K.value->_add_tree_to_process_thread_group(p_owner);
+	}
+}
+
+void Node::_update_process_thread_group_owner() {
+	data.process_thread_group_auto = data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT && data.parent && data.parent->data.process_thread_independent_children;
+
+	if (_owns_process_thread_group()) {
+		data.process_thread_group_owner = this;
+		_add_process_group();
+	} else if (data.parent) {
+		data.process_thread_group_owner = data.parent->data.process_thread_group_owner;
+	} else {
+		data.process_thread_group_owner = nullptr;
 	}
 }
 bool Node::is_processing_internal() const {
@@ -1093,7 +1107,7 @@ void Node::set_process_thread_group_order(int p_order) {
 	data.process_thread_group_order = p_order;
 
 	// Not yet in the tree (or not a group owner, in whose case this is pointless but harmless); trivial update.
-	if (!is_inside_tree() || data.process_thread_group_owner != this) {
+	if (!is_inside_tree() || (data.process_thread_group_owner != this && !data.process_thread_independent_children)) {
 		return;
 	}
 
@@ -1169,23 +1183,13 @@ void Node::set_process_thread_group(ProcessThreadGroup p_mode) {
 	}
 
 	_remove_tree_from_process_thread_group();
-	if (data.process_thread_group != PROCESS_THREAD_GROUP_INHERIT) {
+	if (_owns_process_thread_group()) {
 		_remove_process_group();
 	}
 
 	data.process_thread_group = p_mode;
 
-	if (p_mode == PROCESS_THREAD_GROUP_INHERIT) {
-		if (data.parent) {
-			data.process_thread_group_owner = data.parent->data.process_thread_group_owner;
-		} else {
-			data.process_thread_group_owner = nullptr;
-		}
-	} else {
-		data.process_thread_group_owner = this;
-		_add_process_group();
-	}
-
+	_update_process_thread_group_owner();
 	_add_tree_to_process_thread_group(data.process_thread_group_owner);
 
 	notify_property_list_changed();
@@ -1195,6 +1199,48 @@ Node::ProcessThreadGroup Node::get_process_thread_group() const {
 	return data.process_thread_group;
 }
 
+void Node::set_process_thread_independent_children(bool p_enabled) {
+	ERR_FAIL_COND_MSG(data.inside_tree && !Thread::is_main_thread(), "Changing the process thread group can only be done from the main thread. Use call_deferred(\"set_process_thread_independent_children\",enabled).");
+	if (data.process_thread_independent_children == p_enabled) {
+		return;
+	}
+
+	if (!is_inside_tree()) {
+		// Not yet in the tree; trivial update.
+		data.process_thread_independent_children = p_enabled;
+		notify_property_list_changed();
+		return;
+	}
+
+	for (KeyValue<StringName, Node *> &K : data.children) {
+		Node *child = K.value;
+		if (child->data.process_thread_group != PROCESS_THREAD_GROUP_INHERIT) {
+			continue; // Not affected, owns its group anyway.
+		}
+		child->_remove_tree_from_process_thread_group();
+		if (child->data.process_thread_group_auto) {
+			child->_remove_process_group();
+		}
+	}
+
+	data.process_thread_independent_children = p_enabled;
+
+	for (KeyValue<StringName, Node *> &K : data.children) {
+		Node *child = K.value;
+		if (child->data.process_thread_group != PROCESS_THREAD_GROUP_INHERIT) {
+			continue;
+		}
+		child->_update_process_thread_group_owner();
+		child->_add_tree_to_process_thread_group(child->data.process_thread_group_owner);
+	}
+
+	notify_property_list_changed();
+}
+
+bool Node::is_process_thread_independent_children() const {
+	return data.process_thread_independent_children;
+}
+
 void Node::set_process_thread_messages(BitField<ProcessThreadMessages> p_flags) {
 	ERR_THREAD_GUARD
 	if (data.process_thread_messages == p_flags) {
@@ -1402,6 +1448,7 @@ void Node::set_name(const String &p_name) {
 	data.name = name;
 
 	if (data.parent) {
+		data.parent->_invalidate_resolved_paths();
 		data.parent->_validate_child_name(this, true);
 		bool success = data.parent->data.children.replace_key(old_name, data.name);
 		ERR_FAIL_COND_MSG(!success, "Renaming child in hashtable failed, this is a bug.");
@@ -1602,11 +1649,11 @@ Node::InternalMode Node::get_internal_mode() const {
 	return data.internal_mode;
 }
 
-void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalMode p_internal_mode) {
-	//add a child node quickly, without name validation
-
+void Node::_insert_child(Node *p_child, const StringName &p_name, InternalMode p_internal_mode) {
 	p_child->data.name = p_name;
 	data.children.insert(p_name, p_child);
+	_invalidate_resolved_paths();
+	p_child->_invalidate_resolved_paths();
 
 	p_child->data.internal_mode = p_internal_mode;
 	switch (p_internal_mode) {
@@ -1623,12 +1670,27 @@ void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalM
 
 	p_child->data.parent = this;
 
-	if (!data.children_cache_dirty && p_internal_mode == INTERNAL_MODE_DISABLED && data.internal_children_back_count_cache == 0) {
-		// Special case, also add to the cached children array since its cheap.
-		data.children_cache.push_back(p_child);
-	} else {
-		data.children_cache_dirty = true;
+	if (!data.children_cache_dirty) {
+		// Indices are relative to each range, so inserting at the end of the child's range
+		// keeps all other indices valid and the cache doesn't need to be rebuilt.
+		switch (p_internal_mode) {
+			case INTERNAL_MODE_FRONT: {
+				data.children_cache.insert(data.internal_children_front_count_cache - 1, p_child);
+			} break;
+			case INTERNAL_MODE_BACK: {
+				data.children_cache.push_back(p_child);
+			} break;
+			case INTERNAL_MODE_DISABLED: {
+				data.children_cache.insert(data.internal_children_front_count_cache + data.external_children_count_cache - 1, p_child);
+			} break;
+		}
 	}
+}
+
+void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalMode p_internal_mode) {
+	//add a child node quickly, without name validation
+
+	_insert_child(p_child, p_name, p_internal_mode);
 
 	p_child->notification(NOTIFICATION_PARENTED);
 
@@ -1668,6 +1730,70 @@ void Node::add_child(Node *p_child, bool p_force_readable_name, InternalMode p_i
 	_add_child_nocheck(p_child, p_child->data.name, p_internal);
 }
 
+void Node::add_children(const TypedArray<Node> &p_children, bool p_force_readable_name, InternalMode p_internal) {
+	ERR_FAIL_COND_MSG(data.inside_tree && !Thread::is_main_thread(), "Adding children to a node inside the SceneTree is only allowed from the main thread. Use call_deferred(\"add_children\",nodes).");
+
+	ERR_THREAD_GUARD
+	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy setting up children, `add_children()` failed. Consider using `add_children.call_deferred(children)` instead.");
+
+	LocalVector<Node *> children;
+	children.reserve(p_children.size());
+
+	for (int i = 0; i < p_children.size(); i++) {
+		Node *child = Object::cast_to<Node>(p_children[i]);
+		ERR_CONTINUE(!child);
+		ERR_CONTINUE_MSG(child == this, vformat("Can't add child '%s' to itself.", child->get_name()));
+		ERR_CONTINUE_MSG(child->data.parent, vformat("Can't add child '%s' to '%s', already has a parent '%s'.", child->get_name(), get_name(), child->data.parent->get_name()));
+#ifdef DEBUG_ENABLED
+		ERR_CONTINUE_MSG(child->is_ancestor_of(this), vformat("Can't add child '%s' to '%s' as it would result in a cyclic dependency since '%s' is already a parent of '%s'.", child->get_name(), get_name(), child->get_name(), get_name()));
+#endif
+
+		_validate_child_name(child, p_force_readable_name);
+		_insert_child(child, child->data.name, p_internal);
+		child->notification(NOTIFICATION_PARENTED);
+		children.push_back(child);
+	}
+
+	if (children.is_empty()) {
+		return;
+	}
+
+	if (data.tree) {
+		// All the children enter the tree before any of them is ready, like the nodes of an instantiated scene.
+		SceneTree *tree = data.tree;
+		tree->_begin_tree_batch();
+
+		for (Node *child : children) {
+			// The callbacks of a previous child may have removed this one already.
+			if (child->data.parent == this && !child->data.tree) {
+				child->data.tree = tree;
+				child->_propagate_enter_tree();
+			}
+		}
+
+		if (data.ready_notified) {
+			for (Node *child : children) {
+				if (child->data.parent == this && child->data.inside_tree && !child->data.ready_notified) {
+					child->_propagate_ready();
+				}
+			}
+		}
+
+		tree->tree_changed();
+		tree->_end_tree_batch();
+	}
+
+	for (Node *child : children) {
+		if (child->data.parent == this) {
+			child->data.parent_owned = data.in_constructor;
+			add_child_notify(child);
+		}
+	}
+
+	notification(NOTIFICATION_CHILD_ORDER_CHANGED);
+	emit_signal(SNAME("child_order_changed"));
+}
+
 void Node::add_sibling(Node *p_sibling, bool p_force_readable_name) {
 	ERR_FAIL_COND_MSG(data.inside_tree && !Thread::is_main_thread(), "Adding a sibling to a node inside the SceneTree is only allowed from the main thread. Use call_deferred(\"add_sibling\",node).");
 	ERR_FAIL_NULL(p_sibling);
@@ -1687,13 +1813,14 @@ void Node::remove_child(Node *p_child) {
 	ERR_FAIL_COND(p_child->data.parent != this);
 
 	/**
-	 *  Do not change the data.internal_children*cache counters here.
+	 *  If the children cache is dirty, do not change the
+	 *  data.internal_children*cache counters here.
 	 *  Because if nodes are re-added, the indices can remain
 	 *  greater-than-everything indices and children added remain
 	 *  properly ordered.
 	 *
 	 *  All children indices and counters will be updated next time the
-	 *  cache is re-generated.
+	 *  cache is re-generated. Otherwise, the cache is updated in place.
 	 */
 
 	data.blocked++;
@@ -1705,8 +1832,10 @@ void Node::remove_child(Node *p_child) {
 
 	data.blocked--;
 
-	data.children_cache_dirty = true;
+	_remove_child_from_cache(p_child);
 	bool success = data.children.erase(p_child->data.name);
+	_invalidate_resolved_paths();
+	p_child->_invalidate_resolved_paths();
 	ERR_FAIL_COND_MSG(!success, "Children name does not match parent name in hashtable, this is a bug.");
 
 	p_child->data.parent = nullptr;
@@ -1720,6 +1849,70 @@ void Node::remove_child(Node *p_child) {
 	}
 }
 
+void Node::remove_children(const TypedArray<Node> &p_children) {
+	ERR_FAIL_COND_MSG(data.inside_tree && !Thread::is_main_thread(), "Removing children from a node inside the SceneTree is only allowed from the main thread. Use call_deferred(\"remove_children\",nodes).");
+	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy adding/removing children, `remove_children()` can't be called at this time. Consider using `remove_children.call_deferred(children)` instead.");
+
+	LocalVector<Node *> children;
+	children.reserve(p_children.size());
+	HashSet<Node *> listed;
+
+	for (int i = 0; i < p_children.size(); i++) {
+		Node *child = Object::cast_to<Node>(p_children[i]);
+		ERR_CONTINUE(!child);
+		ERR_CONTINUE(child->data.parent != this);
+		if (listed.has(child)) {
+			continue;
+		}
+		listed.insert(child);
+		children.push_back(child);
+	}
+
+	if (children.is_empty()) {
+		return;
+	}
+
+	// See remove_child() regarding the internal children counters.
+
+	SceneTree *tree = data.tree;
+	if (tree) {
+		tree->_begin_tree_batch();
+	}
+
+	data.blocked++;
+	for (Node *child : children) {
+		child->_set_tree(nullptr);
+
+		remove_child_notify(child);
+		child->notification(NOTIFICATION_UNPARENTED);
+	}
+	data.blocked--;
+
+	_remove_children_from_cache(listed);
+	_invalidate_resolved_paths();
+	for (Node *child : children) {
+		bool success = data.children.erase(child->data.name);
+		child->_invalidate_resolved_paths();
+		ERR_CONTINUE_MSG(!success, "Children name does not match parent name in hashtable, this is a bug.");
+
+		child->data.parent = nullptr;
+		child->data.index = -1;
+	}
+
+	if (tree) {
+		tree->_end_tree_batch();
+	}
+
+	notification(NOTIFICATION_CHILD_ORDER_CHANGED);
+	emit_signal(SNAME("child_order_changed"));
+
+	if (data.inside_tree) {
+		for (Node *child : children) {
+			child->_propagate_after_exit_tree();
+		}
+	}
+}
+
 void Node::_update_children_cache_impl() const {
 	// Assign children
 	data.children_cache.resize(data.children.size());
@@ -1751,6 +1944,72 @@ void Node::_update_children_cache_impl() const {
 	data.children_cache_dirty = false;
 }
 
+void Node::_remove_child_from_cache(Node *p_child) {
+	if (data.children_cache_dirty) {
+		return; // Will be rebuilt without the child anyway.
+	}
+
+	// Only the children after this one in the same range need their index updated.
+	int pos = p_child->data.index;
+	int range_end = 0;
+	int *range_count = nullptr;
+	switch (p_child->data.internal_mode) {
+		case INTERNAL_MODE_FRONT: {
+			range_end = data.internal_children_front_count_cache;
+			range_count = &data.internal_children_front_count_cache;
+		} break;
+		case INTERNAL_MODE_DISABLED: {
+			pos += data.internal_children_front_count_cache;
+			range_end = data.internal_children_front_count_cache + data.external_children_count_cache;
+			range_count = &data.external_children_count_cache;
+		} break;
+		case INTERNAL_MODE_BACK: {
+			pos += data.internal_children_front_count_cache + data.external_children_count_cache;
+			range_end = data.children_cache.size();
+			range_count = &data.internal_children_back_count_cache;
+		} break;
+	}
+	ERR_FAIL_COND_MSG(data.children_cache[pos] != p_child, "Child index does not match the children cache, this is a bug.");
+
+	(*range_count)--;
+	data.children_cache.remove_at(pos);
+	for (int i = pos; i < range_end - 1; i++) {
+		data.children_cache[i]->data.index--;
+	}
+}
+
+void Node::_remove_children_from_cache(const HashSet<Node *> &p_children) {
+	if (data.children_cache_dirty) {
+		return;
+	}
+
+	// Single pass keeping the order of the remaining children.
+	data.external_children_count_cache = 0;
+	data.internal_children_back_count_cache = 0;
+	data.internal_children_front_count_cache = 0;
+
+	uint32_t count = 0;
+	for (uint32_t i = 0; i < data.children_cache.size(); i++) {
+		Node *child = data.children_cache[i];
+		if (p_children.has(child)) {
+			continue;
+		}
+		switch (child->data.internal_mode) {
+			case INTERNAL_MODE_DISABLED: {
+				child->data.index = data.external_children_count_cache++;
+			} break;
+			case INTERNAL_MODE_FRONT: {
+				child->data.index = data.internal_children_front_count_cache++;
+			} break;
+			case INTERNAL_MODE_BACK: {
+				child->data.index = data.internal_children_back_count_cache++;
+			} break;
+		}
+		data.children_cache[count++] = child;
+	}
+	data.children_cache.resize(count);
+}
+
 int Node::get_child_count(bool p_include_internal) const {
 	ERR_THREAD_GUARD_V(0);
 	_update_children_cache();
@@ -1811,6 +2070,28 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 
 	ERR_FAIL_COND_V_MSG(!data.inside_tree && p_path.is_absolute(), nullptr, "Can't use get_node() with absolute paths from outside the active scene tree.");
 
+	// Single names are found with one lookup anyway. Nodes outside the tree
+	// may be accessed from several threads, so they don't cache anything.
+	const bool cache_path = data.inside_tree && !p_path.is_absolute() && p_path.get_name_count() > 1;
+	if (cache_path && data.resolved_paths) {
+		const Data::ResolvedPath *resolved = data.resolved_paths->paths.getptr(p_path);
+		if (resolved) {
+			// Checked in order: each node is reached from the previous one, so it's only
+			// known to still be alive once the previous one is known to be unchanged.
+			bool valid = true;
+			for (const Pair<const Node *, uint64_t> &E : resolved->chain) {
+				if (E.first->data.path_version != E.second) {
+					valid = false;
+					break;
+				}
+			}
+			if (valid) {
+				return resolved->node;
+			}
+		}
+	}
+	LocalVector<Pair<const Node *, uint64_t>> chain;
+
 	Node *current = nullptr;
 	Node *root = nullptr;
 
@@ -1835,6 +2116,9 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 				return nullptr;
 			}
 
+			if (cache_path) {
+				chain.push_back(Pair<const Node *, uint64_t>(current, current->data.path_version));
+			}
 			next = current->data.parent;
 		} else if (current == nullptr) {
 			if (name == root->get_name()) {
@@ -1842,8 +2126,14 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 			}
 
 		} else if (name.is_node_unique_name()) {
+			if (cache_path) {
+				chain.push_back(Pair<const Node *, uint64_t>(current, current->data.path_version));
+			}
 			Node **unique = current->data.owned_unique_nodes.getptr(name);
 			if (!unique && current->data.owner) {
+				if (cache_path) {
+					chain.push_back(Pair<const Node *, uint64_t>(current->data.owner, current->data.owner->data.path_version));
+				}
 				unique = current->data.owner->data.owned_unique_nodes.getptr(name);
 			}
 			if (!unique) {
@@ -1851,6 +2141,9 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 			}
 			next = *unique;
 		} else {
+			if (cache_path) {
+				chain.push_back(Pair<const Node *, uint64_t>(current, current->data.path_version));
+			}
 			next = nullptr;
 			const Node *const *node = current->data.children.getptr(name);
 			if (node) {
@@ -1862,6 +2155,18 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 		current = next;
 	}
 
+	if (cache_path && current) {
+		if (!data.resolved_paths) {
+			data.resolved_paths = memnew(Data::ResolvedPaths);
+		}
+		if (data.resolved_paths->paths.size() >= Data::ResolvedPaths::MAX_PATHS && !data.resolved_paths->paths.has(p_path)) {
+			data.resolved_paths->paths.clear();
+		}
+		Data::ResolvedPath &resolved = data.resolved_paths->paths[p_path];
+		resolved.node = current;
+		resolved.chain = std::move(chain);
+	}
+
 	return current;
 }
 
@@ -2119,6 +2424,7 @@ void Node::_set_owner_nocheck(Node *p_owner) {
 
 	ERR_FAIL_COND(data.owner);
 	data.owner = p_owner;
+	_invalidate_resolved_paths();
 	data.owner->data.owned.push_back(this);
 	data.OW = data.owner->data.owned.back();
 
@@ -2133,6 +2439,7 @@ void Node::_release_unique_name_in_owner() {
 		return; // Ignore.
 	}
 	data.owner->data.owned_unique_nodes.erase(key);
+	data.owner->_invalidate_resolved_paths();
 }
 
 void Node::_acquire_unique_name_in_owner() {
@@ -2147,6 +2454,7 @@ void Node::_acquire_unique_name_in_owner() {
 		return;
 	}
 	data.owner->data.owned_unique_nodes[key] = this;
+	data.owner->_invalidate_resolved_paths();
 }
 
 void Node::set_unique_name_in_owner(bool p_enabled) {
@@ -2219,6 +2527,7 @@ void Node::_clean_up_owner() {
 	}
 	data.owner->data.owned.erase(data.OW);
 	data.owner = nullptr;
+	_invalidate_resolved_paths();
 	data.OW = nullptr;
 }
 
@@ -3500,7 +3809,7 @@ void Node::_call_unhandled_key_input(const Ref<InputEvent> &p_event) {
 }
 
 void Node::_validate_property(PropertyInfo &p_property) const {
-	if ((p_property.name == "process_thread_group_order" || p_property.name == "process_thread_messages") && data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT) {
+	if ((p_property.name == "process_thread_group_order" || p_property.name == "process_thread_messages") && data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT && !data.process_thread_independent_children) {
 		p_property.usage = 0;
 	}
 }
@@ -3615,7 +3924,9 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_name", "name"), &Node::set_name);
 	ClassDB::bind_method(D_METHOD("get_name"), &Node::get_name);
 	ClassDB::bind_method(D_METHOD("add_child", "node", "force_readable_name", "internal"), &Node::add_child, DEFVAL(false), DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("add_children", "nodes", "force_readable_name", "internal"), &Node::add_children, DEFVAL(false), DEFVAL(0));
 	ClassDB::bind_method(D_METHOD("remove_child", "node"), &Node::remove_child);
+	ClassDB::bind_method(D_METHOD("remove_children", "nodes"), &Node::remove_children);
 	ClassDB::bind_method(D_METHOD("reparent", "new_parent", "keep_global_transform"), &Node::reparent, DEFVAL(true));
 	ClassDB::bind_method(D_METHOD("get_child_count", "include_internal"), &Node::get_child_count, DEFVAL(false)); // Note that the default value bound for include_internal is false, while the method is declared with true. This is because internal nodes are irrelevant for GDSCript.
 	ClassDB::bind_method(D_METHOD("get_children", "include_internal"), &Node::get_children, DEFVAL(false));
@@ -3680,6 +3991,9 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_process_thread_messages", "flags"), &Node::set_process_thread_messages);
 	ClassDB::bind_method(D_METHOD("get_process_thread_messages"), &Node::get_process_thread_messages);
 
+	ClassDB::bind_method(D_METHOD("set_process_thread_independent_children", "enabled"), &Node::set_process_thread_independent_children);
+	ClassDB::bind_method(D_METHOD("is_process_thread_independent_children"), &Node::is_process_thread_independent_children);
+
 	ClassDB::bind_method(D_METHOD("set_process_thread_group_order", "order"), &Node::set_process_thread_group_order);
 	ClassDB::bind_method(D_METHOD("get_process_thread_group_order"), &Node::get_process_thread_group_order);
 
@@ -3890,6 +4204,7 @@ void Node::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group", PROPERTY_HINT_ENUM, "Inherit,Main Thread,Sub Thread"), "set_process_thread_group", "get_process_thread_group");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group_order"), "set_process_thread_group_order", "get_process_thread_group_order");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_messages", PROPERTY_HINT_FLAGS, "Process,Physics Process"), "set_process_thread_messages", "get_process_thread_messages");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "process_thread_independent_children"), "set_process_thread_independent_children", "is_process_thread_independent_children");
 
 	ADD_GROUP("Physics Interpolation", "physics_interpolation_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "physics_interpolation_mode", PROPERTY_HINT_ENUM, "Inherit,On,Off"), "set_physics_interpolation_mode", "get_physics_interpolation_mode");
@@ -3968,6 +4283,11 @@ Node::~Node() {
 	data.children.clear();
 	data.children_cache.clear();
 
+	if (data.resolved_paths) {
+		memdelete(data.resolved_paths);
+		data.resolved_paths = nullptr;
+	}
+
 	ERR_FAIL_COND(data.parent);
 	ERR_FAIL_COND(data.children_cache.size());
 
@@ -128,6 +128,8 @@ public:
 
 	static int orphan_node_count;
 
+	typedef void (*ProcessCallback)(Node *p_node, int p_notification);
+
 	void _update_process(bool p_enable, bool p_for_children);
 
 private:
@@ -196,6 +198,9 @@ private:
 		int process_thread_group_order = 0;
 		BitField<ProcessThreadMessages> process_thread_messages;
 		void *process_group = nullptr; // to avoid cyclic dependency
+		bool process_thread_independent_children = false;
+		bool process_thread_group_auto = false; // Owns a sub-thread group because the parent has independent children.
+		ProcessCallback process_callback = nullptr;
 
 		int multiplayer_authority = 1; // Server by default.
 		Variant rpc_config = Dictionary();
@@ -259,6 +264,22 @@ private:
 
 		mutable NodePath *path_cache = nullptr;
 
+		// Incremented whenever a change could make get_node() take a different step from this node:
+		// children added, removed or renamed, parent or owner changed, unique names of owned nodes changed.
+		uint64_t path_version = 0;
+
+		// Nodes found by get_node() for paths with several names. Each one stays valid while
+		// the nodes the path went through keep the path_version they had when it was resolved.
+		struct ResolvedPath {
+			Node *node = nullptr;
+			LocalVector<Pair<const Node *, uint64_t>> chain;
+		};
+		struct ResolvedPaths {
+			static constexpr uint32_t MAX_PATHS = 32; // Paths built at runtime shouldn't grow the cache forever.
+			HashMap<NodePath, ResolvedPath> paths;
+		};
+		mutable ResolvedPaths *resolved_paths = nullptr;
+
 	} data;
 
 	Ref<MultiplayerAPI> multiplayer;
@@ -316,6 +337,8 @@ private:
 	}
 
 	void _update_children_cache_impl() const;
+	void _remove_child_from_cache(Node *p_child);
+	void _remove_children_from_cache(const HashSet<Node *> &p_children);
 
 	// Process group management
 	void _add_process_group();
@@ -324,9 +347,28 @@ private:
 	void _remove_from_process_thread_group();
 	void _remove_tree_from_process_thread_group();
 	void _add_tree_to_process_thread_group(Node *p_owner);
+	void _update_process_thread_group_owner();
+
+	_FORCE_INLINE_ bool _owns_process_thread_group() const { return data.process_thread_group != PROCESS_THREAD_GROUP_INHERIT || data.process_thread_group_auto; }
+
+	// Settings of the process group owned by this node. Automatic groups are
+	// processed in sub-threads and use the settings of the parent.
+	_FORCE_INLINE_ bool _is_process_thread_group_threaded() const { return data.process_thread_group_auto || data.process_thread_group == PROCESS_THREAD_GROUP_SUB_THREAD; }
+	_FORCE_INLINE_ int _get_process_thread_group_order() const { return data.process_thread_group_auto ? data.parent->data.process_thread_group_order : data.process_thread_group_order; }
+	_FORCE_INLINE_ BitField<ProcessThreadMessages> _get_process_thread_messages() const { return data.process_thread_group_auto ? data.parent->data.process_thread_messages : data.process_thread_messages; }
 
 	static thread_local Node *current_process_thread_group;
 
+	_FORCE_INLINE_ void _invalidate_resolved_paths() { data.path_version++; }
+
+	_FORCE_INLINE_ void _process_notification(int p_notification) {
+		if (data.process_callback && !get_script_instance()) {
+			data.process_callback(this, p_notification);
+		} else {
+			notification(p_notification);
+		}
+	}
+
 	Variant _call_deferred_thread_group_bind(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	Variant _call_thread_safe_bind(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 
@@ -345,6 +387,10 @@ protected:
 
 	virtual void _physics_interpolated_changed();
 
+	// Lets a native class handle the process notifications of its nodes directly, instead of dispatching
+	// them through notification(). Queried when entering the tree, ignored for nodes with a script.
+	virtual ProcessCallback _get_process_callback() const { return nullptr; }
+
 	virtual void add_child_notify(Node *p_child);
 	virtual void remove_child_notify(Node *p_child);
 	virtual void move_child_notify(Node *p_child);
@@ -357,6 +403,7 @@ protected:
 
 	friend class SceneState;
 
+	void _insert_child(Node *p_child, const StringName &p_name, InternalMode p_internal_mode);
 	void _add_child_nocheck(Node *p_child, const StringName &p_name, InternalMode p_internal_mode = INTERNAL_MODE_DISABLED);
 	void _set_owner_nocheck(Node *p_owner);
 	void _set_name_nocheck(const StringName &p_name);
@@ -460,8 +507,10 @@ public:
 	InternalMode get_internal_mode() const;
 
 	void add_child(Node *p_child, bool p_force_readable_name = false, InternalMode p_internal = INTERNAL_MODE_DISABLED);
+	void add_children(const TypedArray<Node> &p_children, bool p_force_readable_name = false, InternalMode p_internal = INTERNAL_MODE_DISABLED);
 	void add_sibling(Node *p_sibling, bool p_force_readable_name = false);
 	void remove_child(Node *p_child);
+	void remove_children(const TypedArray<Node> &p_children);
 
 	int get_child_count(bool p_include_internal = true) const;
 	Node *get_child(int p_index, bool p_include_internal = true) const;
@@ -692,6 +741,9 @@ public:
 	void set_process_thread_group(ProcessThreadGroup p_mode);
 	ProcessThreadGroup get_process_thread_group() const;
 
+	void set_process_thread_independent_children(bool p_enabled);
+	bool is_process_thread_independent_children() const;
+
 	static void print_orphan_nodes();
 
 #ifdef TOOLS_ENABLED
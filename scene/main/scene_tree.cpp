@@ -133,6 +133,10 @@ void SceneTree::ClientPhysicsInterpolation::physics_process() {
 #endif
 
 void SceneTree::tree_changed() {
+	if (tree_batch_depth > 0) {
+		tree_batch_changed = true;
+		return;
+	}
 	emit_signal(tree_changed_name);
 }
 
@@ -163,9 +167,20 @@ SceneTree::Group *SceneTree::add_to_group(const StringName &p_group, Node *p_nod
 		E = group_map.insert(p_group, Group());
 	}
 
+	if (tree_batch_depth > 0) {
+		// Nodes can't be added twice (they keep track of their groups), so skip the linear search.
+		// If the node left the group earlier in the batch, it's still in the list.
+		if (E->value.pending_removal.erase(p_node)) {
+			// The node may have moved in the tree since it was sorted.
+			E->value.changed = true;
+		} else {
+			E->value.nodes.push_back(p_node);
+		}
+		return &E->value;
+	}
+
 	ERR_FAIL_COND_V_MSG(E->value.nodes.has(p_node), &E->value, "Already in group: " + p_group + ".");
 	E->value.nodes.push_back(p_node);
-	E->value.changed = true;
 	return &E->value;
 }
 
@@ -175,8 +190,23 @@ void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	ERR_FAIL_COND(!E);
 
-	E->value.nodes.erase(p_node);
-	if (E->value.nodes.is_empty()) {
+	if (tree_batch_depth > 0) {
+		if (E->value.pending_removal.is_empty()) {
+			groups_pending_removal.push_back(p_group);
+		}
+		E->value.pending_removal.insert(p_node);
+		return;
+	}
+
+	Group &g = E->value;
+	int index = g.nodes.find(p_node);
+	if (index >= 0) {
+		if (index < g.sorted_count) {
+			g.sorted_count--;
+		}
+		g.nodes.remove_at(index);
+	}
+	if (g.nodes.is_empty()) {
 		group_map.remove(E);
 	}
 }
@@ -192,15 +222,94 @@ void SceneTree::make_group_changed(const StringName &p_group) {
 void SceneTree::flush_transform_notifications() {
 	_THREAD_SAFE_METHOD_
 
+#ifndef _3D_DISABLED
+	const bool batch_was_open = instance_xform_batch.open;
+	instance_xform_batch.open = true;
+#endif // _3D_DISABLED
+
 	SelfList<Node> *n = xform_change_list.first();
 	while (n) {
 		Node *node = n->self();
 		SelfList<Node> *nx = n->next();
 		xform_change_list.remove(n);
+		xform_change_pass.increment();
 		n = nx;
 		node->notification(NOTIFICATION_TRANSFORM_CHANGED);
 	}
+
+#ifndef _3D_DISABLED
+	instance_xform_batch.open = batch_was_open;
+	if (!batch_was_open) {
+		_flush_instance_transforms();
+	}
+#endif // _3D_DISABLED
+}
+
+#ifndef _3D_DISABLED
+bool SceneTree::_queue_instance_transform(RID p_instance, const Transform3D &p_transform, uint64_t &r_version, uint32_t &r_index) {
+	InstanceTransformBatch &batch = instance_xform_batch;
+	if (!Thread::is_main_thread() || !batch.open) {
+		return false;
+	}
+
+	if (r_version == batch.version) {
+		// Already queued during this flush, only the latest transform matters.
+		batch.transforms[r_index] = p_transform;
+		return true;
+	}
+
+	r_version = batch.version;
+	r_index = batch.instances.size();
+	batch.instances.push_back(p_instance);
+	batch.transforms.push_back(p_transform);
+	return true;
+}
+
+void SceneTree::_cancel_instance_transform(uint64_t &r_version, uint32_t p_index) {
+	InstanceTransformBatch &batch = instance_xform_batch;
+	if (r_version != batch.version) {
+		return;
+	}
+
+	batch.instances[p_index] = RID();
+	batch.cancelled++;
+	r_version = 0;
+}
+
+void SceneTree::_flush_instance_transforms() {
+	InstanceTransformBatch &batch = instance_xform_batch;
+	if (batch.instances.is_empty()) {
+		return;
+	}
+
+	const uint32_t count = batch.instances.size() - batch.cancelled;
+	Vector<RID> instances;
+	instances.resize(count);
+	Vector<Transform3D> transforms;
+	transforms.resize(count);
+
+	RID *instances_ptrw = instances.ptrw();
+	Transform3D *transforms_ptrw = transforms.ptrw();
+	uint32_t j = 0;
+	for (uint32_t i = 0; i < batch.instances.size(); i++) {
+		if (batch.instances[i].is_null()) {
+			continue; // Cancelled, the instance may be freed already.
+		}
+		instances_ptrw[j] = batch.instances[i];
+		transforms_ptrw[j] = batch.transforms[i];
+		j++;
+	}
+
+	batch.instances.clear();
+	batch.transforms.clear();
+	batch.cancelled = 0;
+	batch.version++;
+
+	if (count > 0) {
+		RenderingServer::get_singleton()->instance_set_transforms(instances, transforms);
+	}
 }
+#endif // _3D_DISABLED
 
 void SceneTree::_flush_ugc() {
 	ugc_locked = true;
@@ -223,19 +332,50 @@ void SceneTree::_flush_ugc() {
 }
 
 void SceneTree::_update_group_order(Group &g) {
-	if (!g.changed) {
-		return;
-	}
-	if (g.nodes.is_empty()) {
+	int gr_node_count = g.nodes.size();
+	if (!g.changed && g.sorted_count >= gr_node_count) {
 		return;
 	}
 
 	Node **gr_nodes = g.nodes.ptrw();
-	int gr_node_count = g.nodes.size();
-
 	SortArray<Node *, Node::Comparator> node_sort;
-	node_sort.sort(gr_nodes, gr_node_count);
+	Node::Comparator compare;
+
+	int unsorted_count = gr_node_count - g.sorted_count;
+	if (g.changed || unsorted_count > g.sorted_count) {
+		node_sort.sort(gr_nodes, gr_node_count);
+	} else {
+		// Only a few nodes were added since the last sort, sort them and merge them
+		// into the sorted ones from the back, finding each spot with a binary search.
+		node_sort.sort(gr_nodes + g.sorted_count, unsorted_count);
+
+		LocalVector<Node *> added;
+		added.resize(unsorted_count);
+		memcpy(added.ptr(), gr_nodes + g.sorted_count, sizeof(Node *) * unsorted_count);
+
+		int sorted_end = g.sorted_count;
+		int write = gr_node_count;
+		for (int i = unsorted_count - 1; i >= 0; i--) {
+			Node *node = added[i];
+			int lo = 0;
+			int hi = sorted_end;
+			while (lo < hi) {
+				int mid = (lo + hi) / 2;
+				if (compare(node, gr_nodes[mid])) {
+					hi = mid;
+				} else {
+					lo = mid + 1;
+				}
+			}
+			int move_count = sorted_end - lo;
+			write -= move_count;
+			memmove(gr_nodes + write, gr_nodes + lo, sizeof(Node *) * move_count);
+			gr_nodes[--write] = node;
+			sorted_end = lo;
+		}
+	}
 
+	g.sorted_count = gr_node_count;
 	g.changed = false;
 }
 
@@ -244,6 +384,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 
 	{
 		_THREAD_SAFE_METHOD_
+		_flush_pending_removals();
 
 		HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 		if (!E) {
@@ -278,7 +419,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 		nodes_copy = g.nodes;
 	}
 
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr();
 	int gr_node_count = nodes_copy.size();
 
 	{
@@ -336,6 +477,7 @@ void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_gr
 	Vector<Node *> nodes_copy;
 	{
 		_THREAD_SAFE_METHOD_
+		_flush_pending_removals();
 		HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 		if (!E) {
 			return;
@@ -350,7 +492,7 @@ void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_gr
 		nodes_copy = g.nodes;
 	}
 
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr();
 	int gr_node_count = nodes_copy.size();
 
 	{
@@ -398,6 +540,7 @@ void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group
 	Vector<Node *> nodes_copy;
 	{
 		_THREAD_SAFE_METHOD_
+		_flush_pending_removals();
 
 		HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 		if (!E) {
@@ -412,7 +555,7 @@ void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group
 
 		nodes_copy = g.nodes;
 	}
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr();
 	int gr_node_count = nodes_copy.size();
 
 	{
@@ -1047,17 +1190,17 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 
 		if (p_physics) {
 			if (n->is_physics_processing_internal()) {
-				n->notification(Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
+				n->_process_notification(Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
 			}
 			if (n->is_physics_processing()) {
-				n->notification(Node::NOTIFICATION_PHYSICS_PROCESS);
+				n->_process_notification(Node::NOTIFICATION_PHYSICS_PROCESS);
 			}
 		} else {
 			if (n->is_processing_internal()) {
-				n->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
+				n->_process_notification(Node::NOTIFICATION_INTERNAL_PROCESS);
 			}
 			if (n->is_processing()) {
-				n->notification(Node::NOTIFICATION_PROCESS);
+				n->_process_notification(Node::NOTIFICATION_PROCESS);
 			}
 		}
 	}
@@ -1114,17 +1257,17 @@ void SceneTree::_process(bool p_physics) {
 	uint32_t process_count = 0;
 	nodes_removed_on_group_call_lock++;
 
-	int current_order = process_groups[0]->owner ? process_groups[0]->owner->data.process_thread_group_order : 0;
-	bool current_threaded = process_groups[0]->owner ? process_groups[0]->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD : false;
+	int current_order = process_groups[0]->owner ? process_groups[0]->owner->_get_process_thread_group_order() : 0;
+	bool current_threaded = process_groups[0]->owner ? process_groups[0]->owner->_is_process_thread_group_threaded() : false;
 
 	for (uint32_t i = 0; i <= group_count; i++) {
-		int order = i < group_count && process_groups[i]->owner ? process_groups[i]->owner->data.process_thread_group_order : 0;
-		bool threaded = i < group_count && process_groups[i]->owner ? process_groups[i]->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD : false;
+		int order = i < group_count && process_groups[i]->owner ? process_groups[i]->owner->_get_process_thread_group_order() : 0;
+		bool threaded = i < group_count && process_groups[i]->owner ? process_groups[i]->owner->_is_process_thread_group_threaded() : false;
 
 		if (i == group_count || current_order != order || current_threaded != threaded) {
 			if (process_count > 0) {
 				// Proceed to process the group.
-				bool using_threads = process_groups[from]->owner && process_groups[from]->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD && !node_threading_disabled;
+				bool using_threads = process_groups[from]->owner && process_groups[from]->owner->_is_process_thread_group_threaded() && !node_threading_disabled;
 
 				if (using_threads) {
 					local_process_group_cache.clear();
@@ -1166,13 +1309,13 @@ void SceneTree::_process(bool p_physics) {
 		if (p_physics) {
 			if (!pg->physics_nodes.is_empty()) {
 				process_valid = true;
-			} else if ((pg == &default_process_group || (pg->owner != nullptr && pg->owner->data.process_thread_messages.has_flag(Node::FLAG_PROCESS_THREAD_MESSAGES_PHYSICS))) && pg->call_queue.has_messages()) {
+			} else if ((pg == &default_process_group || (pg->owner != nullptr && pg->owner->_get_process_thread_messages().has_flag(Node::FLAG_PROCESS_THREAD_MESSAGES_PHYSICS))) && pg->call_queue.has_messages()) {
 				process_valid = true;
 			}
 		} else {
 			if (!pg->nodes.is_empty()) {
 				process_valid = true;
-			} else if ((pg == &default_process_group || (pg->owner != nullptr && pg->owner->data.process_thread_messages.has_flag(Node::FLAG_PROCESS_THREAD_MESSAGES))) && pg->call_queue.has_messages()) {
+			} else if ((pg == &default_process_group || (pg->owner != nullptr && pg->owner->_get_process_thread_messages().has_flag(Node::FLAG_PROCESS_THREAD_MESSAGES))) && pg->call_queue.has_messages()) {
 				process_valid = true;
 			}
 		}
@@ -1190,12 +1333,12 @@ void SceneTree::_process(bool p_physics) {
 }
 
 bool SceneTree::ProcessGroupSort::operator()(const ProcessGroup *p_left, const ProcessGroup *p_right) const {
-	int left_order = p_left->owner ? p_left->owner->data.process_thread_group_order : 0;
-	int right_order = p_right->owner ? p_right->owner->data.process_thread_group_order : 0;
+	int left_order = p_left->owner ? p_left->owner->_get_process_thread_group_order() : 0;
+	int right_order = p_right->owner ? p_right->owner->_get_process_thread_group_order() : 0;
 
 	if (left_order == right_order) {
-		int left_threaded = p_left->owner != nullptr && p_left->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD ? 0 : 1;
-		int right_threaded = p_right->owner != nullptr && p_right->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD ? 0 : 1;
+		int left_threaded = p_left->owner != nullptr && p_left->owner->_is_process_thread_group_threaded() ? 0 : 1;
+		int right_threaded = p_right->owner != nullptr && p_right->owner->_is_process_thread_group_threaded() ? 0 : 1;
 		return left_threaded < right_threaded;
 	} else {
 		return left_order < right_order;
@@ -1231,6 +1374,19 @@ void SceneTree::_remove_node_from_process_group(Node *p_node, Node *p_owner) {
 	_THREAD_SAFE_METHOD_
 	ProcessGroup *pg = p_owner ? (ProcessGroup *)p_owner->data.process_group : &default_process_group;
 
+	if (tree_batch_depth > 0) {
+		if (pg->nodes_pending_removal.is_empty() && pg->physics_nodes_pending_removal.is_empty()) {
+			process_groups_pending_removal.push_back(pg);
+		}
+		if (p_node->is_processing() || p_node->is_processing_internal()) {
+			pg->nodes_pending_removal.insert(p_node);
+		}
+		if (p_node->is_physics_processing() || p_node->is_physics_processing_internal()) {
+			pg->physics_nodes_pending_removal.insert(p_node);
+		}
+		return;
+	}
+
 	if (p_node->is_processing() || p_node->is_processing_internal()) {
 		bool found = pg->nodes.erase(p_node);
 		ERR_FAIL_COND(!found);
@@ -1246,21 +1402,93 @@ void SceneTree::_add_node_to_process_group(Node *p_node, Node *p_owner) {
 	_THREAD_SAFE_METHOD_
 	ProcessGroup *pg = p_owner ? (ProcessGroup *)p_owner->data.process_group : &default_process_group;
 
+	// If the node left this process group earlier in a batch, it's still in the list.
 	if (p_node->is_processing() || p_node->is_processing_internal()) {
-		pg->nodes.push_back(p_node);
+		if (!pg->nodes_pending_removal.erase(p_node)) {
+			pg->nodes.push_back(p_node);
+		}
 		pg->node_order_dirty = true;
 	}
 
 	if (p_node->is_physics_processing() || p_node->is_physics_processing_internal()) {
-		pg->physics_nodes.push_back(p_node);
+		if (!pg->physics_nodes_pending_removal.erase(p_node)) {
+			pg->physics_nodes.push_back(p_node);
+		}
 		pg->physics_node_order_dirty = true;
 	}
 }
 
+void SceneTree::_begin_tree_batch() {
+	_THREAD_SAFE_METHOD_
+	tree_batch_depth++;
+}
+
+void SceneTree::_end_tree_batch() {
+	_THREAD_SAFE_METHOD_
+	ERR_FAIL_COND(tree_batch_depth == 0);
+	tree_batch_depth--;
+	if (tree_batch_depth > 0) {
+		return;
+	}
+
+	_flush_pending_removals();
+
+	if (tree_batch_changed) {
+		tree_batch_changed = false;
+		tree_changed();
+	}
+}
+
+static void _erase_nodes_from_list(Vector<Node *> &r_nodes, HashSet<Node *> &r_erased, int *r_sorted_count = nullptr) {
+	// Erase in a single pass, keeping the order of the remaining nodes.
+	Node **ptr = r_nodes.ptrw();
+	int count = 0;
+	int sorted_count = 0;
+	for (int i = 0; i < r_nodes.size(); i++) {
+		if (r_sorted_count && i == *r_sorted_count) {
+			sorted_count = count;
+		}
+		if (!r_erased.has(ptr[i])) {
+			ptr[count++] = ptr[i];
+		}
+	}
+	if (r_sorted_count) {
+		*r_sorted_count = *r_sorted_count >= r_nodes.size() ? count : sorted_count;
+	}
+	r_nodes.resize(count);
+	r_erased.clear();
+}
+
+void SceneTree::_flush_pending_removals() {
+	_THREAD_SAFE_METHOD_
+	if (groups_pending_removal.is_empty() && process_groups_pending_removal.is_empty()) {
+		return;
+	}
+
+	for (const StringName &group : groups_pending_removal) {
+		HashMap<StringName, Group>::Iterator E = group_map.find(group);
+		if (!E) {
+			continue; // Already flushed and emptied, the group can be listed twice.
+		}
+		_erase_nodes_from_list(E->value.nodes, E->value.pending_removal, &E->value.sorted_count);
+		if (E->value.nodes.is_empty()) {
+			group_map.remove(E);
+		}
+	}
+	groups_pending_removal.clear();
+
+	for (ProcessGroup *pg : process_groups_pending_removal) {
+		_erase_nodes_from_list(pg->nodes, pg->nodes_pending_removal);
+		_erase_nodes_from_list(pg->physics_nodes, pg->physics_nodes_pending_removal);
+	}
+	process_groups_pending_removal.clear();
+}
+
 void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_call_type, const Ref<InputEvent> &p_input, Viewport *p_viewport) {
 	Vector<Node *> nodes_copy;
 	{
 		_THREAD_SAFE_METHOD_
+		_flush_pending_removals();
 
 		HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 		if (!E) {
@@ -1279,7 +1507,7 @@ void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_cal
 	}
 
 	int gr_node_count = nodes_copy.size();
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr();
 
 	{
 		_THREAD_SAFE_METHOD_
@@ -1384,6 +1612,7 @@ int64_t SceneTree::get_frame() const {
 
 TypedArray<Node> SceneTree::_get_nodes_in_group(const StringName &p_group) {
 	_THREAD_SAFE_METHOD_
+	_flush_pending_removals();
 	TypedArray<Node> ret;
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	if (!E) {
@@ -1398,7 +1627,7 @@ TypedArray<Node> SceneTree::_get_nodes_in_group(const StringName &p_group) {
 
 	ret.resize(nc);
 
-	Node **ptr = E->value.nodes.ptrw();
+	Node *const *ptr = E->value.nodes.ptr();
 	for (int i = 0; i < nc; i++) {
 		ret[i] = ptr[i];
 	}
@@ -1408,7 +1637,8 @@ TypedArray<Node> SceneTree::_get_nodes_in_group(const StringName &p_group) {
 
 bool SceneTree::has_group(const StringName &p_identifier) const {
 	_THREAD_SAFE_METHOD_
-	return group_map.has(p_identifier);
+	HashMap<StringName, Group>::ConstIterator E = group_map.find(p_identifier);
+	return E && E->value.nodes.size() > E->value.pending_removal.size();
 }
 
 int SceneTree::get_node_count_in_group(const StringName &p_group) const {
@@ -1418,11 +1648,12 @@ int SceneTree::get_node_count_in_group(const StringName &p_group) const {
 		return 0;
 	}
 
-	return E->value.nodes.size();
+	return E->value.nodes.size() - E->value.pending_removal.size();
 }
 
 Node *SceneTree::get_first_node_in_group(const StringName &p_group) {
 	_THREAD_SAFE_METHOD_
+	_flush_pending_removals();
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	if (!E) {
 		return nullptr; // No group.
@@ -1439,6 +1670,7 @@ Node *SceneTree::get_first_node_in_group(const StringName &p_group) {
 
 void SceneTree::get_nodes_in_group(const StringName &p_group, List<Node *> *p_list) {
 	_THREAD_SAFE_METHOD_
+	_flush_pending_removals();
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	if (!E) {
 		return;
@@ -1449,7 +1681,7 @@ void SceneTree::get_nodes_in_group(const StringName &p_group, List<Node *> *p_li
 	if (nc == 0) {
 		return;
 	}
-	Node **ptr = E->value.nodes.ptrw();
+	Node *const *ptr = E->value.nodes.ptr();
 	for (int i = 0; i < nc; i++) {
 		p_list->push_back(ptr[i]);
 	}
@@ -96,6 +96,8 @@ private:
 		CallQueue call_queue;
 		Vector<Node *> nodes;
 		Vector<Node *> physics_nodes;
+		HashSet<Node *> nodes_pending_removal;
+		HashSet<Node *> physics_nodes_pending_removal;
 		bool node_order_dirty = true;
 		bool physics_node_order_dirty = true;
 		bool removed = false;
@@ -120,6 +122,10 @@ private:
 
 	struct Group {
 		Vector<Node *> nodes;
+		HashSet<Node *> pending_removal;
+		// Number of leading nodes known to be in tree order, the ones after were added since the last sort.
+		int sorted_count = 0;
+		// Set when the tree order of the nodes may have changed, which requires a full sort.
 		bool changed = false;
 	};
 
@@ -148,6 +154,14 @@ private:
 	HashMap<StringName, Group> group_map;
 	bool _quit = false;
 
+	// While a batch of children is added or removed (see Node::add_children()), nodes
+	// leaving groups and process lists are erased in one pass when the batch ends,
+	// and tree_changed is only emitted once.
+	int tree_batch_depth = 0;
+	bool tree_batch_changed = false;
+	LocalVector<StringName> groups_pending_removal;
+	LocalVector<ProcessGroup *> process_groups_pending_removal;
+
 	bool _physics_interpolation_enabled = false;
 
 	StringName tree_changed_name = "tree_changed";
@@ -234,6 +248,10 @@ private:
 	void _remove_node_from_process_group(Node *p_node, Node *p_owner);
 	void _add_node_to_process_group(Node *p_node, Node *p_owner);
 
+	void _begin_tree_batch();
+	void _end_tree_batch();
+	void _flush_pending_removals();
+
 	void _call_group_flags(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	void _call_group(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 
@@ -244,6 +262,26 @@ private:
 	friend class Viewport;
 
 	SelfList<Node>::List xform_change_list;
+	// Incremented whenever a node leaves xform_change_list, see Node3D::_propagate_transform_changed().
+	SafeNumeric<uint64_t> xform_change_pass{ 1 };
+
+#ifndef _3D_DISABLED
+	friend class VisualInstance3D;
+
+	// Instance transforms sent while flushing transform notifications,
+	// passed to the RenderingServer in a single call once the flush is done.
+	struct InstanceTransformBatch {
+		LocalVector<RID> instances;
+		LocalVector<Transform3D> transforms;
+		uint32_t cancelled = 0;
+		uint64_t version = 1;
+		bool open = false;
+	} instance_xform_batch;
+
+	bool _queue_instance_transform(RID p_instance, const Transform3D &p_transform, uint64_t &r_version, uint32_t &r_index);
+	void _cancel_instance_transform(uint64_t &r_version, uint32_t p_index);
+	void _flush_instance_transforms();
+#endif // _3D_DISABLED
 
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
@@ -87,6 +87,16 @@ void Timer::_notification(int p_what) {
 	}
 }
 
+void Timer::_process_callback(Node *p_node, int p_notification) {
+	// Timers handle their process notifications themselves, Node and Object don't need to see them.
+	static_cast<Timer *>(p_node)->_notification(p_notification);
+}
+
+Node::ProcessCallback Timer::_get_process_callback() const {
+	// Subclasses, including extension classes, may handle the notifications themselves.
+	return get_class_name() == SNAME("Timer") ? &Timer::_process_callback : nullptr;
+}
+
 void Timer::set_wait_time(double p_time) {
 	ERR_FAIL_COND_MSG(p_time <= 0, "Time should be greater than zero.");
 	wait_time = p_time;
@@ -45,10 +45,14 @@ class Timer : public Node {
 
 	double time_left = -1.0;
 
+	static void _process_callback(Node *p_node, int p_notification);
+
 protected:
 	void _notification(int p_what);
 	static void _bind_methods();
 
+	virtual ProcessCallback _get_process_callback() const override;
+
 public:
 	enum TimerProcessCallback {
 		TIMER_PROCESS_PHYSICS,
@@ -91,11 +91,31 @@ void ConcavePolygonShape3D::_update_shape() {
 	Dictionary d;
 	d["faces"] = faces;
 	d["backface_collision"] = backface_collision;
+	d["store_bvh"] = store_bvh;
+	if (!bvh_data.is_empty()) {
+		// The server ignores it if it doesn't match the faces.
+		d["bvh"] = bvh_data;
+		bvh_data.clear();
+	}
 	PhysicsServer3D::get_singleton()->shape_set_data(get_shape(), d);
 
 	Shape3D::_update_shape();
 }
 
+void ConcavePolygonShape3D::_set_bvh_data(const Vector<uint8_t> &p_data) {
+	// Used on the next shape update, which happens when the faces are set.
+	bvh_data = p_data;
+}
+
+Vector<uint8_t> ConcavePolygonShape3D::_get_bvh_data() const {
+	if (!store_bvh || faces.is_empty()) {
+		return Vector<uint8_t>();
+	}
+
+	Dictionary d = PhysicsServer3D::get_singleton()->shape_get_data(get_shape());
+	return d.get("bvh", Vector<uint8_t>());
+}
+
 void ConcavePolygonShape3D::set_faces(const Vector<Vector3> &p_faces) {
 	faces = p_faces;
 	_update_shape();
@@ -119,6 +139,19 @@ bool ConcavePolygonShape3D::is_backface_collision_enabled() const {
 	return backface_collision;
 }
 
+void ConcavePolygonShape3D::set_store_bvh(bool p_enabled) {
+	store_bvh = p_enabled;
+
+	// The physics server only serializes the BVH when asked to.
+	if (!faces.is_empty()) {
+		_update_shape();
+	}
+}
+
+bool ConcavePolygonShape3D::is_storing_bvh() const {
+	return store_bvh;
+}
+
 void ConcavePolygonShape3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_faces", "faces"), &ConcavePolygonShape3D::set_faces);
 	ClassDB::bind_method(D_METHOD("get_faces"), &ConcavePolygonShape3D::get_faces);
@@ -126,8 +159,17 @@ void ConcavePolygonShape3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_backface_collision_enabled", "enabled"), &ConcavePolygonShape3D::set_backface_collision_enabled);
 	ClassDB::bind_method(D_METHOD("is_backface_collision_enabled"), &ConcavePolygonShape3D::is_backface_collision_enabled);
 
+	ClassDB::bind_method(D_METHOD("set_store_bvh", "enabled"), &ConcavePolygonShape3D::set_store_bvh);
+	ClassDB::bind_method(D_METHOD("is_storing_bvh"), &ConcavePolygonShape3D::is_storing_bvh);
+
+	ClassDB::bind_method(D_METHOD("_set_bvh_data", "bvh_data"), &ConcavePolygonShape3D::_set_bvh_data);
+	ClassDB::bind_method(D_METHOD("_get_bvh_data"), &ConcavePolygonShape3D::_get_bvh_data);
+
+	// Must come before "data", so it's available when the faces are set on load.
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_BYTE_ARRAY, "bvh_data", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL), "_set_bvh_data", "_get_bvh_data");
 	ADD_PROPERTY(PropertyInfo(Variant::PACKED_VECTOR3_ARRAY, "data", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL), "set_faces", "get_faces");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "backface_collision"), "set_backface_collision_enabled", "is_backface_collision_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "store_bvh"), "set_store_bvh", "is_storing_bvh");
 }
 
 ConcavePolygonShape3D::ConcavePolygonShape3D() :
@@ -41,6 +41,11 @@ class ConcavePolygonShape3D : public Shape3D {
 	Vector<Vector3> faces;
 	bool backface_collision = false;
 
+	// Acceleration structure prebuilt by the physics server, stored in the
+	// resource so it doesn't need to be rebuilt when loading.
+	bool store_bvh = false;
+	Vector<uint8_t> bvh_data;
+
 	struct DrawEdge {
 		Vector3 a;
 		Vector3 b;
@@ -66,6 +71,9 @@ protected:
 
 	virtual void _update_shape() override;
 
+	void _set_bvh_data(const Vector<uint8_t> &p_data);
+	Vector<uint8_t> _get_bvh_data() const;
+
 public:
 	void set_faces(const Vector<Vector3> &p_faces);
 	Vector<Vector3> get_faces() const;
@@ -73,6 +81,9 @@ public:
 	void set_backface_collision_enabled(bool p_enabled);
 	bool is_backface_collision_enabled() const;
 
+	void set_store_bvh(bool p_enabled);
+	bool is_storing_bvh() const;
+
 	virtual Vector<Vector3> get_debug_mesh_lines() const override;
 	virtual Ref<ArrayMesh> get_debug_arraymesh_faces(const Color &p_modulate) const override;
 	virtual real_t get_enclosing_radius() const override;
@@ -123,6 +123,61 @@ Ref<Resource> SceneState::get_remap_resource(const Ref<Resource> &p_resource, Ha
 	return remap_resource;
 }
 
+void SceneState::_cache_property_setters() const {
+	MutexLock lock(property_setters_mutex);
+	if (property_setters_cached.is_set()) {
+		return;
+	}
+
+	property_setters.resize(nodes.size());
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+		NodeSetters &node_setters = property_setters[i];
+		node_setters.class_name = StringName();
+		node_setters.properties.clear();
+
+		// Only nodes created from a built-in class, the setters of extension classes may be reloaded.
+		if ((i == 0 && base_scene_idx >= 0) || n.instance >= 0 || n.type == TYPE_INSTANTIATED || n.type < 0 || n.type >= names.size()) {
+			continue;
+		}
+		const StringName &class_name = names[n.type];
+		if (!ClassDB::class_exists(class_name)) {
+			continue;
+		}
+		const ClassDB::APIType api = ClassDB::get_api_type(class_name);
+		if (api != ClassDB::API_CORE && api != ClassDB::API_EDITOR) {
+			continue;
+		}
+
+		node_setters.class_name = class_name;
+		node_setters.properties.resize(n.properties.size());
+		for (int j = 0; j < n.properties.size(); j++) {
+			PropertySetter &setter = node_setters.properties[j];
+			setter = PropertySetter();
+
+			const int name_idx = n.properties[j].name;
+			if ((name_idx & FLAG_PATH_PROPERTY_IS_NODE) || name_idx < 0 || name_idx >= names.size()) {
+				continue;
+			}
+
+			const StringName setter_name = ClassDB::get_property_setter(class_name, names[name_idx]);
+			if (setter_name == StringName()) {
+				continue;
+			}
+			setter.method = ClassDB::get_method(class_name, setter_name);
+			setter.index = ClassDB::get_property_index(class_name, names[name_idx]);
+		}
+	}
+
+	property_setters_cached.set();
+}
+
+void SceneState::_clear_property_setters() {
+	MutexLock lock(property_setters_mutex);
+	property_setters.clear();
+	property_setters_cached.clear();
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
@@ -164,6 +219,17 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	LocalVector<DeferredNodePathProperties> deferred_node_paths;
 
+	// Classes can be reloaded while editing, so the resolved setters are only used at runtime.
+	const NodeSetters *setters = nullptr;
+	if (p_edit_state == GEN_EDIT_STATE_DISABLED && !Engine::get_singleton()->is_editor_hint()) {
+		if (!property_setters_cached.is_set()) {
+			_cache_property_setters();
+		}
+		if (property_setters.size() == (uint32_t)nc) {
+			setters = property_setters.ptr();
+		}
+	}
+
 	for (int i = 0; i < nc; i++) {
 		const NodeData &n = nd[i];
 
@@ -307,6 +373,11 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 				Dictionary missing_resource_properties;
 				HashMap<Ref<Resource>, Ref<Resource>> resources_local_to_sub_scene; // Record the mappings in the sub-scene.
 
+				const PropertySetter *node_setters = nullptr;
+				if (setters && !missing_node && setters[i].properties.size() == (uint32_t)nprop_count && setters[i].class_name == node->get_class_name()) {
+					node_setters = setters[i].properties.ptr();
+				}
+
 				for (int j = 0; j < nprop_count; j++) {
 					bool valid;
 
@@ -410,7 +481,20 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
+							if (node_setters && node_setters[j].method && !node->get_script_instance()) {
+								// Same as ClassDB::set_property(), without looking up the setter.
+								Callable::CallError ce;
+								if (node_setters[j].index >= 0) {
+									Variant index = node_setters[j].index;
+									const Variant *args[2] = { &index, &value };
+									node_setters[j].method->call(node, args, 2, ce);
+								} else {
+									const Variant *args[1] = { &value };
+									node_setters[j].method->call(node, args, 1, ce);
+								}
+							} else {
+								node->set(snames[nprops[j].name], value, &valid);
+							}
 						}
 						if (p_edit_state == GEN_EDIT_STATE_INSTANCE && value.get_type() != Variant::OBJECT) {
 							value = value.duplicate(true); // Duplicate arrays and dictionaries for the editor.
@@ -1304,6 +1388,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_clear_property_setters();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1502,6 +1587,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 
 	ERR_FAIL_COND_MSG(version > PACKED_SCENE_VERSION, "Save format version too new.");
 
+	_clear_property_setters();
+
 	const int node_count = p_dictionary["node_count"];
 	const Vector<int> snodes = p_dictionary["nodes"];
 	ERR_FAIL_COND(snodes.size() < node_count);
@@ -1515,8 +1602,9 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 		int namecount = snames.size();
 		names.resize(namecount);
 		const String *r = snames.ptr();
-		for (int i = 0; i < names.size(); i++) {
-			names.write[i] = r[i];
+		StringName *w = names.ptrw();
+		for (int i = 0; i < namecount; i++) {
+			w[i] = r[i];
 		}
 	}
 
@@ -1525,8 +1613,9 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	if (svariants.size()) {
 		int varcount = svariants.size();
 		variants.resize(varcount);
+		Variant *w = variants.ptrw();
 		for (int i = 0; i < varcount; i++) {
-			variants.write[i] = svariants[i];
+			w[i] = svariants[i];
 		}
 
 	} else {
@@ -1536,9 +1625,10 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	nodes.resize(node_count);
 	if (node_count) {
 		const int *r = snodes.ptr();
+		NodeData *w = nodes.ptrw();
 		int idx = 0;
 		for (int i = 0; i < node_count; i++) {
-			NodeData &nd = nodes.write[i];
+			NodeData &nd = w[i];
 			nd.parent = r[idx++];
 			nd.owner = r[idx++];
 			nd.type = r[idx++];
@@ -1548,13 +1638,15 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 			nd.index--; //0 is invalid, stored as 1
 			nd.instance = r[idx++];
 			nd.properties.resize(r[idx++]);
+			NodeData::Property *props = nd.properties.ptrw();
 			for (int j = 0; j < nd.properties.size(); j++) {
-				nd.properties.write[j].name = r[idx++];
-				nd.properties.write[j].value = r[idx++];
+				props[j].name = r[idx++];
+				props[j].value = r[idx++];
 			}
 			nd.groups.resize(r[idx++]);
+			int *groups = nd.groups.ptrw();
 			for (int j = 0; j < nd.groups.size(); j++) {
-				nd.groups.write[j] = r[idx++];
+				groups[j] = r[idx++];
 			}
 		}
 	}
@@ -1986,6 +2078,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.instance = p_instance;
 	nd.index = p_index;
 
+	_clear_property_setters();
 	nodes.push_back(nd);
 
 	return nodes.size() - 1;
@@ -2002,6 +2095,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 		prop.name |= FLAG_PATH_PROPERTY_IS_NODE;
 	}
 	prop.value = p_value;
+	_clear_property_setters();
 	nodes.write[p_node].properties.push_back(prop);
 }
 
@@ -2188,6 +2282,26 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 	return s;
 }
 
+TypedArray<Node> PackedScene::instantiate_many(int p_count, GenEditState p_edit_state) const {
+	ERR_FAIL_COND_V(p_count < 0, TypedArray<Node>());
+
+	TypedArray<Node> instances;
+	instances.resize(p_count);
+	for (int i = 0; i < p_count; i++) {
+		Node *s = instantiate(p_edit_state);
+		if (!s) {
+			// Don't leak the instances already created.
+			for (int j = 0; j < i; j++) {
+				memdelete(Object::cast_to<Node>(instances[j]));
+			}
+			return TypedArray<Node>();
+		}
+		instances[i] = s;
+	}
+
+	return instances;
+}
+
 void PackedScene::replace_state(Ref<SceneState> p_by) {
 	state = p_by;
 	state->set_path(get_path());
@@ -2274,6 +2388,7 @@ void PackedScene::reset_state() {
 void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pack", "path"), &PackedScene::pack);
 	ClassDB::bind_method(D_METHOD("instantiate", "edit_state"), &PackedScene::instantiate, DEFVAL(GEN_EDIT_STATE_DISABLED));
+	ClassDB::bind_method(D_METHOD("instantiate_many", "count", "edit_state"), &PackedScene::instantiate_many, DEFVAL(GEN_EDIT_STATE_DISABLED));
 	ClassDB::bind_method(D_METHOD("can_instantiate"), &PackedScene::can_instantiate);
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
@@ -32,6 +32,9 @@
 #define PACKED_SCENE_H
 
 #include "core/io/resource.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
 class SceneState : public RefCounted {
@@ -89,6 +92,25 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Setters of the properties stored for each node, resolved once through ClassDB
+	// so instantiating the same scene repeatedly doesn't look them up every time.
+	struct PropertySetter {
+		MethodBind *method = nullptr;
+		int index = -1;
+	};
+
+	struct NodeSetters {
+		StringName class_name;
+		LocalVector<PropertySetter> properties;
+	};
+
+	mutable LocalVector<NodeSetters> property_setters;
+	mutable SafeFlag property_setters_cached;
+	mutable Mutex property_setters_mutex;
+
+	void _cache_property_setters() const;
+	void _clear_property_setters();
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -257,6 +279,7 @@ public:
 
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
+	TypedArray<Node> instantiate_many(int p_count, GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
 
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
@@ -616,6 +616,56 @@ bool PhysicsServer2D::_body_test_motion(RID p_body, const Ref<PhysicsTestMotionP
 	return body_test_motion(p_body, p_parameters->get_parameters(), result_ptr);
 }
 
+PackedInt32Array PhysicsServer2D::_body_test_motion_batch(const TypedArray<RID> &p_bodies, const TypedArray<PhysicsTestMotionParameters2D> &p_parameters, const TypedArray<PhysicsTestMotionResult2D> &p_results) {
+	const int count = p_bodies.size();
+	ERR_FAIL_COND_V_MSG(p_parameters.size() != count, PackedInt32Array(), "The number of motion parameters must match the number of bodies.");
+	ERR_FAIL_COND_V_MSG(!p_results.is_empty() && p_results.size() != count, PackedInt32Array(), "The number of motion results must match the number of bodies.");
+
+	LocalVector<RID> bodies;
+	LocalVector<MotionParameters> parameters;
+	bodies.resize(count);
+	parameters.resize(count);
+	for (int i = 0; i < count; i++) {
+		Ref<PhysicsTestMotionParameters2D> body_parameters = p_parameters[i];
+		ERR_FAIL_COND_V(body_parameters.is_null(), PackedInt32Array());
+		bodies[i] = p_bodies[i];
+		parameters[i] = body_parameters->get_parameters();
+	}
+
+	LocalVector<MotionResult> results;
+	if (!p_results.is_empty()) {
+		results.resize(count);
+	}
+	LocalVector<bool> collided;
+	collided.resize(count);
+
+	body_test_motion_batch(bodies.ptr(), parameters.ptr(), results.ptr(), collided.ptr(), count);
+
+	PackedInt32Array colliding_indices;
+	for (int i = 0; i < count; i++) {
+		if (!results.is_empty()) {
+			Ref<PhysicsTestMotionResult2D> body_result = p_results[i];
+			if (body_result.is_valid()) {
+				*body_result->get_result_ptr() = results[i];
+			}
+		}
+		if (collided[i]) {
+			colliding_indices.push_back(i);
+		}
+	}
+
+	return colliding_indices;
+}
+
+void PhysicsServer2D::body_test_motion_batch(const RID *p_bodies, const MotionParameters *p_parameters, MotionResult *r_results, bool *r_collided, int p_count) {
+	for (int i = 0; i < p_count; i++) {
+		const bool collided = body_test_motion(p_bodies[i], p_parameters[i], r_results ? &r_results[i] : nullptr);
+		if (r_collided) {
+			r_collided[i] = collided;
+		}
+	}
+}
+
 void PhysicsServer2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("world_boundary_shape_create"), &PhysicsServer2D::world_boundary_shape_create);
 	ClassDB::bind_method(D_METHOD("separation_ray_shape_create"), &PhysicsServer2D::separation_ray_shape_create);
@@ -758,6 +808,7 @@ void PhysicsServer2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("body_set_force_integration_callback", "body", "callable", "userdata"), &PhysicsServer2D::body_set_force_integration_callback, DEFVAL(Variant()));
 
 	ClassDB::bind_method(D_METHOD("body_test_motion", "body", "parameters", "result"), &PhysicsServer2D::_body_test_motion, DEFVAL(Variant()));
+	ClassDB::bind_method(D_METHOD("body_test_motion_batch", "bodies", "parameters", "results"), &PhysicsServer2D::_body_test_motion_batch, DEFVAL(TypedArray<PhysicsTestMotionResult2D>()));
 
 	ClassDB::bind_method(D_METHOD("body_get_direct_state", "body"), &PhysicsServer2D::body_get_direct_state);
 
@@ -210,6 +210,7 @@ class PhysicsServer2D : public Object {
 	static PhysicsServer2D *singleton;
 
 	virtual bool _body_test_motion(RID p_body, const Ref<PhysicsTestMotionParameters2D> &p_parameters, const Ref<PhysicsTestMotionResult2D> &p_result = Ref<PhysicsTestMotionResult2D>());
+	PackedInt32Array _body_test_motion_batch(const TypedArray<RID> &p_bodies, const TypedArray<PhysicsTestMotionParameters2D> &p_parameters, const TypedArray<PhysicsTestMotionResult2D> &p_results);
 
 protected:
 	static void _bind_methods();
@@ -523,6 +524,11 @@ public:
 
 	virtual bool body_test_motion(RID p_body, const MotionParameters &p_parameters, MotionResult *r_result = nullptr) = 0;
 
+	// Tests the motion of multiple bodies against the current state of their spaces.
+	// Bodies are not moved, so each motion is tested independently from the others.
+	// r_results and r_collided are optional, and must hold p_count elements otherwise.
+	virtual void body_test_motion_batch(const RID *p_bodies, const MotionParameters *p_parameters, MotionResult *r_results, bool *r_collided, int p_count);
+
 	/* JOINT API */
 
 	virtual RID joint_create() = 0;
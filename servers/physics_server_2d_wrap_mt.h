@@ -262,6 +262,11 @@ public:
 		return physics_server_2d->body_test_motion(p_body, p_parameters, r_result);
 	}
 
+	void body_test_motion_batch(const RID *p_bodies, const MotionParameters *p_parameters, MotionResult *r_results, bool *r_collided, int p_count) override {
+		ERR_FAIL_COND(!Thread::is_main_thread());
+		physics_server_2d->body_test_motion_batch(p_bodies, p_parameters, r_results, r_collided, p_count);
+	}
+
 	// this function only works on physics process, errors and returns null otherwise
 	PhysicsDirectBodyState2D *body_get_direct_state(RID p_body) override {
 		ERR_FAIL_COND_V(!Thread::is_main_thread(), nullptr);
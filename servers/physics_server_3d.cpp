@@ -661,6 +661,56 @@ bool PhysicsServer3D::_body_test_motion(RID p_body, const Ref<PhysicsTestMotionP
 	return body_test_motion(p_body, p_parameters->get_parameters(), result_ptr);
 }
 
+PackedInt32Array PhysicsServer3D::_body_test_motion_batch(const TypedArray<RID> &p_bodies, const TypedArray<PhysicsTestMotionParameters3D> &p_parameters, const TypedArray<PhysicsTestMotionResult3D> &p_results) {
+	const int count = p_bodies.size();
+	ERR_FAIL_COND_V_MSG(p_parameters.size() != count, PackedInt32Array(), "The number of motion parameters must match the number of bodies.");
+	ERR_FAIL_COND_V_MSG(!p_results.is_empty() && p_results.size() != count, PackedInt32Array(), "The number of motion results must match the number of bodies.");
+
+	LocalVector<RID> bodies;
+	LocalVector<MotionParameters> parameters;
+	bodies.resize(count);
+	parameters.resize(count);
+	for (int i = 0; i < count; i++) {
+		Ref<PhysicsTestMotionParameters3D> body_parameters = p_parameters[i];
+		ERR_FAIL_COND_V(body_parameters.is_null(), PackedInt32Array());
+		bodies[i] = p_bodies[i];
+		parameters[i] = body_parameters->get_parameters();
+	}
+
+	LocalVector<MotionResult> results;
+	if (!p_results.is_empty()) {
+		results.resize(count);
+	}
+	LocalVector<bool> collided;
+	collided.resize(count);
+
+	body_test_motion_batch(bodies.ptr(), parameters.ptr(), results.ptr(), collided.ptr(), count);
+
+	PackedInt32Array colliding_indices;
+	for (int i = 0; i < count; i++) {
+		if (!results.is_empty()) {
+			Ref<PhysicsTestMotionResult3D> body_result = p_results[i];
+			if (body_result.is_valid()) {
+				*body_result->get_result_ptr() = results[i];
+			}
+		}
+		if (collided[i]) {
+			colliding_indices.push_back(i);
+		}
+	}
+
+	return colliding_indices;
+}
+
+void PhysicsServer3D::body_test_motion_batch(const RID *p_bodies, const MotionParameters *p_parameters, MotionResult *r_results, bool *r_collided, int p_count) {
+	for (int i = 0; i < p_count; i++) {
+		const bool collided = body_test_motion(p_bodies[i], p_parameters[i], r_results ? &r_results[i] : nullptr);
+		if (r_collided) {
+			r_collided[i] = collided;
+		}
+	}
+}
+
 RID PhysicsServer3D::shape_create(ShapeType p_shape) {
 	switch (p_shape) {
 		case SHAPE_WORLD_BOUNDARY:
@@ -715,6 +765,8 @@ void PhysicsServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("space_set_param", "space", "param", "value"), &PhysicsServer3D::space_set_param);
 	ClassDB::bind_method(D_METHOD("space_get_param", "space", "param"), &PhysicsServer3D::space_get_param);
 	ClassDB::bind_method(D_METHOD("space_get_direct_state", "space"), &PhysicsServer3D::space_get_direct_state);
+	ClassDB::bind_method(D_METHOD("space_save_state", "space"), &PhysicsServer3D::space_save_state);
+	ClassDB::bind_method(D_METHOD("space_restore_state", "space", "state"), &PhysicsServer3D::space_restore_state);
 
 	ClassDB::bind_method(D_METHOD("area_create"), &PhysicsServer3D::area_create);
 	ClassDB::bind_method(D_METHOD("area_set_space", "area", "space"), &PhysicsServer3D::area_set_space);
@@ -835,6 +887,7 @@ void PhysicsServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("body_set_ray_pickable", "body", "enable"), &PhysicsServer3D::body_set_ray_pickable);
 
 	ClassDB::bind_method(D_METHOD("body_test_motion", "body", "parameters", "result"), &PhysicsServer3D::_body_test_motion, DEFVAL(Variant()));
+	ClassDB::bind_method(D_METHOD("body_test_motion_batch", "bodies", "parameters", "results"), &PhysicsServer3D::_body_test_motion_batch, DEFVAL(TypedArray<PhysicsTestMotionResult3D>()));
 
 	ClassDB::bind_method(D_METHOD("body_get_direct_state", "body"), &PhysicsServer3D::body_get_direct_state);
 
@@ -234,6 +234,7 @@ class PhysicsServer3D : public Object {
 	static PhysicsServer3D *singleton;
 
 	virtual bool _body_test_motion(RID p_body, const Ref<PhysicsTestMotionParameters3D> &p_parameters, const Ref<PhysicsTestMotionResult3D> &p_result = Ref<PhysicsTestMotionResult3D>());
+	PackedInt32Array _body_test_motion_batch(const TypedArray<RID> &p_bodies, const TypedArray<PhysicsTestMotionParameters3D> &p_parameters, const TypedArray<PhysicsTestMotionResult3D> &p_results);
 
 protected:
 	static void _bind_methods();
@@ -306,6 +307,10 @@ public:
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const = 0;
 	virtual int space_get_contact_count(RID p_space) const = 0;
 
+	// Snapshots of the simulated state of a space (body transforms, velocities, sleep state and contact caches).
+	virtual Vector<uint8_t> space_save_state(RID p_space) const = 0;
+	virtual Error space_restore_state(RID p_space, const Vector<uint8_t> &p_state) = 0;
+
 	//missing space parameters
 
 	/* AREA API */
@@ -567,6 +572,11 @@ public:
 
 	virtual bool body_test_motion(RID p_body, const MotionParameters &p_parameters, MotionResult *r_result = nullptr) = 0;
 
+	// Tests the motion of multiple bodies against the current state of their spaces.
+	// Bodies are not moved, so each motion is tested independently from the others.
+	// r_results and r_collided are optional, and must hold p_count elements otherwise.
+	virtual void body_test_motion_batch(const RID *p_bodies, const MotionParameters *p_parameters, MotionResult *r_results, bool *r_collided, int p_count);
+
 	/* SOFT BODY */
 
 	virtual RID soft_body_create() = 0;
@@ -1034,6 +1034,16 @@ void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D
 #endif
 }
 
+void RendererSceneCull::instance_set_transforms(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms) {
+	ERR_FAIL_COND(p_instances.size() != p_transforms.size());
+
+	const RID *instances = p_instances.ptr();
+	const Transform3D *transforms = p_transforms.ptr();
+	for (int i = 0; i < p_instances.size(); i++) {
+		instance_set_transform(instances[i], transforms[i]);
+	}
+}
+
 void RendererSceneCull::instance_set_interpolated(RID p_instance, bool p_interpolated) {
 	Instance *instance = instance_owner.get_or_null(p_instance);
 	ERR_FAIL_NULL(instance);
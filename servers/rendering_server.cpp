@@ -102,6 +102,33 @@ PackedInt64Array RenderingServer::_instances_cull_convex_bind(const TypedArray<P
 	return to_int_array(ids);
 }
 
+void RenderingServer::_instance_set_transforms_bind(const TypedArray<RID> &p_instances, const PackedFloat32Array &p_buffer) {
+	ERR_FAIL_COND_MSG(p_buffer.size() != p_instances.size() * 12, "The buffer must contain 12 floats per instance.");
+
+	Vector<RID> instances;
+	instances.resize(p_instances.size());
+	Vector<Transform3D> transforms;
+	transforms.resize(p_instances.size());
+
+	RID *instances_ptrw = instances.ptrw();
+	Transform3D *transforms_ptrw = transforms.ptrw();
+	const float *r = p_buffer.ptr();
+	for (int i = 0; i < p_instances.size(); i++) {
+		instances_ptrw[i] = p_instances[i];
+
+		Transform3D &t = transforms_ptrw[i];
+		t.basis.rows[0] = Vector3(r[0], r[1], r[2]);
+		t.origin.x = r[3];
+		t.basis.rows[1] = Vector3(r[4], r[5], r[6]);
+		t.origin.y = r[7];
+		t.basis.rows[2] = Vector3(r[8], r[9], r[10]);
+		t.origin.z = r[11];
+		r += 12;
+	}
+
+	instance_set_transforms(instances, transforms);
+}
+
 RID RenderingServer::get_test_texture() {
 	if (test_texture.is_valid()) {
 		return test_texture;
@@ -3164,6 +3191,7 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("instance_set_layer_mask", "instance", "mask"), &RenderingServer::instance_set_layer_mask);
 	ClassDB::bind_method(D_METHOD("instance_set_pivot_data", "instance", "sorting_offset", "use_aabb_center"), &RenderingServer::instance_set_pivot_data);
 	ClassDB::bind_method(D_METHOD("instance_set_transform", "instance", "transform"), &RenderingServer::instance_set_transform);
+	ClassDB::bind_method(D_METHOD("instance_set_transforms", "instances", "buffer"), &RenderingServer::_instance_set_transforms_bind);
 	ClassDB::bind_method(D_METHOD("instance_set_interpolated", "instance", "interpolated"), &RenderingServer::instance_set_interpolated);
 	ClassDB::bind_method(D_METHOD("instance_reset_physics_interpolation", "instance"), &RenderingServer::instance_reset_physics_interpolation);
 	ClassDB::bind_method(D_METHOD("instance_attach_object_instance_id", "instance", "id"), &RenderingServer::instance_attach_object_instance_id);
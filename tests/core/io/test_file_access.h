@@ -199,6 +199,100 @@ TEST_CASE("[FileAccess] Get/Store floating point half precision values") {
 	}
 }
 
+TEST_CASE("[FileAccess] Memory mapping") {
+	const String file_path = TestUtils::get_temp_path("file_access_map_test.bin");
+
+	Ref<FileAccess> fw = FileAccess::open(file_path, FileAccess::WRITE);
+	REQUIRE(fw.is_valid());
+	for (int i = 0; i < 10000; i++) {
+		fw->store_8(i % 251);
+	}
+	fw->close();
+
+	Ref<FileAccess> f = FileAccess::open(file_path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+
+	// Mapping out of the file must fail.
+	ERR_PRINT_OFF;
+	CHECK(f->map_buffer(9000, 2000) == nullptr);
+	ERR_PRINT_ON;
+
+	const uint8_t *view = f->map_buffer(5000, 1000);
+#ifdef UNIX_ENABLED
+	REQUIRE(view != nullptr);
+#endif
+	if (view) {
+		bool matches = true;
+		for (int i = 0; i < 1000; i++) {
+			matches = matches && view[i] == (5000 + i) % 251;
+		}
+		CHECK(matches);
+	}
+
+	// Mapping doesn't affect the read position.
+	CHECK_EQ(f->get_position(), 0u);
+	CHECK_EQ(f->get_8(), 0);
+
+	f->close();
+	DirAccess::remove_file_or_error(file_path);
+}
+
+TEST_CASE("[FileAccess] Asynchronous reads") {
+	const String file_path = TestUtils::get_temp_path("file_access_async_test.bin");
+
+	Ref<FileAccess> fw = FileAccess::open(file_path, FileAccess::WRITE);
+	REQUIRE(fw.is_valid());
+	for (int i = 0; i < 100000; i++) {
+		fw->store_8(i % 251);
+	}
+	fw->close();
+
+	Ref<FileAccess> f = FileAccess::open(file_path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	f->seek(10);
+
+	// Several reads in flight, including one past the end of the file.
+	Vector<uint8_t> first;
+	first.resize(50000);
+	Vector<uint8_t> second;
+	second.resize(1000);
+	Vector<uint8_t> last;
+	last.resize(1000);
+	const FileAccess::AsyncReadID first_id = f->read_async(0, first.ptrw(), first.size());
+	const FileAccess::AsyncReadID second_id = f->read_async(70000, second.ptrw(), second.size());
+	const FileAccess::AsyncReadID last_id = f->read_async(99500, last.ptrw(), last.size());
+	REQUIRE(first_id != FileAccess::INVALID_ASYNC_READ_ID);
+	REQUIRE(second_id != FileAccess::INVALID_ASYNC_READ_ID);
+	REQUIRE(last_id != FileAccess::INVALID_ASYNC_READ_ID);
+
+	CHECK_EQ(f->wait_for_async_read(second_id), 1000);
+	CHECK_EQ(f->wait_for_async_read(first_id), 50000);
+	CHECK_EQ(f->wait_for_async_read(last_id), 500);
+
+	bool matches = true;
+	for (int i = 0; i < first.size(); i++) {
+		matches = matches && first[i] == i % 251;
+	}
+	for (int i = 0; i < second.size(); i++) {
+		matches = matches && second[i] == (70000 + i) % 251;
+	}
+	for (int i = 0; i < 500; i++) {
+		matches = matches && last[i] == (99500 + i) % 251;
+	}
+	CHECK(matches);
+
+	// Asynchronous reads don't move the cursor.
+	CHECK_EQ(f->get_position(), 10u);
+
+	// A read can only be waited for once.
+	ERR_PRINT_OFF;
+	CHECK_EQ(f->wait_for_async_read(first_id), -1);
+	ERR_PRINT_ON;
+
+	f->close();
+	DirAccess::remove_file_or_error(file_path);
+}
+
 } // namespace TestFileAccess
 
 #endif // TEST_FILE_ACCESS_H
@@ -490,6 +490,101 @@ TEST_CASE("[Marshalls] Typed dictionary decoding") {
 	CHECK(dictionary[Variant(uint64_t(0x0f123456789abcdef))] == Variant(uint64_t(0x0f123456789abcdef)));
 }
 
+TEST_CASE("[Marshalls] Compact Variant encoding") {
+	int r_len;
+	Array array;
+	array.push_back("ab");
+	array.push_back("ab");
+	array.push_back(-1);
+	uint8_t buffer[11];
+
+	CHECK(encode_variant_compact(array, nullptr, r_len) == OK);
+	CHECK(r_len == 11);
+	CHECK(encode_variant_compact(array, buffer, r_len) == OK);
+	CHECK_MESSAGE(buffer[0] == 0xc0, "COMPACT_ENCODING_MARKER");
+	CHECK_MESSAGE(buffer[1] == 0x1c, "Variant::ARRAY");
+	CHECK_MESSAGE(buffer[2] == 0x03, "Array size.");
+	CHECK_MESSAGE(buffer[3] == 0x04, "Variant::STRING");
+	CHECK_MESSAGE(buffer[4] == 0x04, "String length (2) shifted left, not a reference.");
+	CHECK(buffer[5] == 'a');
+	CHECK(buffer[6] == 'b');
+	CHECK_MESSAGE(buffer[7] == 0x04, "Variant::STRING");
+	CHECK_MESSAGE(buffer[8] == 0x01, "Reference to the first string.");
+	CHECK_MESSAGE(buffer[9] == 0x02, "Variant::INT");
+	CHECK_MESSAGE(buffer[10] == 0x01, "Zigzag encoded -1.");
+
+	Variant variant;
+	CHECK(decode_variant(variant, buffer, 11, &r_len) == OK);
+	CHECK(r_len == 11);
+	CHECK(variant == Variant(array));
+}
+
+TEST_CASE("[Marshalls] Compact Variant round trip") {
+	Array typed_array;
+	typed_array.set_typed(Variant::INT, StringName(), Ref<Script>());
+	typed_array.push_back(int64_t(0x0f123456789abcdef));
+	typed_array.push_back(-7);
+
+	Array entries;
+	for (int i = 0; i < 16; i++) {
+		Dictionary entry;
+		entry["id"] = i;
+		entry["name"] = StringName("enemy");
+		entry["position"] = Vector3(i, 0.5, -i);
+		entry["health"] = 100.0;
+		entry["speed"] = 0.1;
+		entry["path"] = NodePath("/root/Level/Enemies:position:x");
+		entries.push_back(entry);
+	}
+
+	Dictionary value;
+	value["entries"] = entries;
+	value["typed"] = typed_array;
+	value["transform"] = Transform3D(Basis(Vector3(0, 1, 0), 0.5), Vector3(1, 2, 3));
+	value["color"] = Color(0.25, 0.5, 0.75, 1.0);
+	value["rect"] = Rect2i(-3, 4, 100, 200);
+	value["bytes"] = PackedByteArray({ 1, 2, 3 });
+	value["ints"] = PackedInt64Array({ 0, -1, INT64_MAX, INT64_MIN });
+	value["floats"] = PackedFloat32Array({ 0.5, -2.25 });
+	value["strings"] = PackedStringArray({ "a", "", "a" });
+	value["vectors"] = PackedVector2Array({ Vector2(1, 2), Vector2(-3, 4) });
+	value["empty"] = Variant();
+	value[true] = false;
+
+	int legacy_len;
+	CHECK(encode_variant(value, nullptr, legacy_len) == OK);
+
+	int compact_len;
+	CHECK(encode_variant_compact(value, nullptr, compact_len) == OK);
+	CHECK_MESSAGE(compact_len * 2 < legacy_len, "Compact encoding should be less than half the size for this data.");
+
+	Vector<uint8_t> buffer;
+	buffer.resize(compact_len);
+	int r_len;
+	CHECK(encode_variant_compact(value, buffer.ptrw(), r_len) == OK);
+	CHECK(r_len == compact_len);
+
+	Variant decoded;
+	CHECK(decode_variant(decoded, buffer.ptr(), buffer.size(), &r_len) == OK);
+	CHECK(r_len == compact_len);
+	CHECK(decoded == Variant(value));
+
+	Dictionary decoded_dict = decoded;
+	Array decoded_typed = decoded_dict["typed"];
+	CHECK(decoded_typed.get_typed_builtin() == Variant::INT);
+	CHECK(Variant(decoded_dict["transform"]).get_type() == Variant::TRANSFORM3D);
+	Dictionary decoded_entry = Array(decoded_dict["entries"])[3];
+	CHECK(Variant(decoded_entry["name"]).get_type() == Variant::STRING_NAME);
+	CHECK(Variant(decoded_entry["health"]).get_type() == Variant::FLOAT);
+
+	// Every truncated buffer must be rejected.
+	ERR_PRINT_OFF;
+	for (int i = 0; i < compact_len; i++) {
+		CHECK(decode_variant(decoded, buffer.ptr(), i) != OK);
+	}
+	ERR_PRINT_ON;
+}
+
 } // namespace TestMarshalls
 
 #endif // TEST_MARSHALLS_H
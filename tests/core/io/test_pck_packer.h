@@ -117,6 +117,114 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			f->get_length() <= 27000,
 			"The generated non-empty PCK file shouldn't be too large.");
 }
+
+TEST_CASE("[PCKPacker] Pack and load compressed files") {
+	const String source_path = TestUtils::get_temp_path("pck_packer_compressed_source.bin");
+	Vector<uint8_t> contents;
+	contents.resize(200000); // Spans multiple compressed blocks.
+	for (int i = 0; i < contents.size(); i++) {
+		contents.write[i] = (i / 7) % 13;
+	}
+	{
+		Ref<FileAccess> f = FileAccess::open(source_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(contents);
+	}
+
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_compressed.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	pck_packer.set_compression_enabled(true);
+	CHECK(pck_packer.add_file("pck_packer_test/compressed.bin", source_path) == OK);
+	pck_packer.set_compression_enabled(false);
+	CHECK(pck_packer.add_file("pck_packer_test/raw.bin", source_path) == OK);
+	REQUIRE(pck_packer.flush() == OK);
+
+	CHECK_MESSAGE(
+			FileAccess::open(output_pck_path, FileAccess::READ)->get_length() < uint64_t(contents.size() * 2),
+			"The compressed file should take less space than the raw one.");
+	{
+		Ref<FileAccess> f = FileAccess::open(output_pck_path, FileAccess::READ);
+		f->seek(4);
+		CHECK_MESSAGE(f->get_32() == PACK_FORMAT_VERSION, "Packs with compressed files should use the current format version.");
+	}
+
+	REQUIRE(PackedData::get_singleton()->add_pack(output_pck_path, true, 0) == OK);
+	for (const String &path : { String("res://pck_packer_test/compressed.bin"), String("res://pck_packer_test/raw.bin") }) {
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::READ);
+		REQUIRE(f.is_valid());
+		CHECK(f->get_length() == uint64_t(contents.size()));
+
+		f->seek(100000);
+		CHECK(f->get_8() == contents[100000]);
+		f->seek(0);
+		CHECK(f->get_buffer(contents.size()) == contents);
+		CHECK(f->eof_reached() == false);
+	}
+	PackedData::get_singleton()->remove_path("pck_packer_test/compressed.bin");
+	PackedData::get_singleton()->remove_path("pck_packer_test/raw.bin");
+}
+
+TEST_CASE("[PCKPacker] Packs without compressed files keep the previous format version") {
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_uncompressed.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	const String base_dir = OS::get_singleton()->get_executable_path().get_base_dir();
+	CHECK(pck_packer.add_file("version.py", base_dir.path_join("../version.py"), "version.py") == OK);
+	REQUIRE(pck_packer.flush() == OK);
+
+	Ref<FileAccess> f = FileAccess::open(output_pck_path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	f->seek(4);
+	CHECK(f->get_32() == PACK_FORMAT_VERSION_MIN);
+}
+
+TEST_CASE("[PCKPacker] Corrupted compressed files are rejected") {
+	const String source_path = TestUtils::get_temp_path("pck_packer_corrupted_source.bin");
+	Vector<uint8_t> contents;
+	contents.resize(200000);
+	for (int i = 0; i < contents.size(); i++) {
+		contents.write[i] = (i / 7) % 13;
+	}
+	{
+		Ref<FileAccess> f = FileAccess::open(source_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(contents);
+	}
+
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_corrupted.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	pck_packer.set_compression_enabled(true);
+	CHECK(pck_packer.add_file("pck_packer_test/corrupted.bin", source_path) == OK);
+	REQUIRE(pck_packer.flush() == OK);
+
+	// Find the header of the compressed file, and claim many more blocks than the file can hold.
+	Vector<uint8_t> pck = FileAccess::get_file_as_bytes(output_pck_path);
+	const uint8_t header[] = { 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00 }; // 64 KiB blocks, 4 blocks.
+	int header_ofs = -1;
+	for (int i = 0; i + (int)sizeof(header) <= pck.size() && header_ofs == -1; i++) {
+		if (memcmp(pck.ptr() + i, header, sizeof(header)) == 0) {
+			header_ofs = i;
+		}
+	}
+	REQUIRE(header_ofs != -1);
+	pck.write[header_ofs + 4] = 0xff;
+	pck.write[header_ofs + 5] = 0xff;
+	{
+		Ref<FileAccess> f = FileAccess::open(output_pck_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(pck);
+	}
+
+	REQUIRE(PackedData::get_singleton()->add_pack(output_pck_path, true, 0) == OK);
+	ERR_PRINT_OFF;
+	Ref<FileAccess> f = FileAccess::open("res://pck_packer_test/corrupted.bin", FileAccess::READ);
+	ERR_PRINT_ON;
+	CHECK(f.is_valid());
+	CHECK_FALSE(f->is_open());
+	PackedData::get_singleton()->remove_path("pck_packer_test/corrupted.bin");
+}
 } // namespace TestPCKPacker
 
 #endif // TEST_PCK_PACKER_H
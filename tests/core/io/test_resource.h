@@ -112,6 +112,52 @@ TEST_CASE("[Resource] Saving and loading") {
 			"The loaded child resource name should be equal to the expected value.");
 }
 
+TEST_CASE("[Resource] Saving and loading math types in binary format") {
+	const Transform3D transform = Transform3D(Basis(Vector3(0, 1, 0), 0.5).scaled(Vector3(1, 2, 3)), Vector3(4, 5, 6));
+	const Transform2D transform_2d = Transform2D(0.25, Vector2(1.5, 2), 0.1, Vector2(-3, 4));
+	const AABB aabb = AABB(Vector3(-1, -2, -3), Vector3(2, 4, 6));
+	const Projection projection = Projection::create_perspective(75, 1.5, 0.05, 4000);
+
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_meta("vector2", Vector2(1.25, -2.5));
+	resource->set_meta("vector3", Vector3(1, 2, 3));
+	resource->set_meta("vector4", Vector4(1, 2, 3, 4));
+	resource->set_meta("rect2", Rect2(1, 2, 3, 4));
+	resource->set_meta("plane", Plane(Vector3(0, 1, 0), 5));
+	resource->set_meta("quaternion", Quaternion(Vector3(1, 0, 0), 0.75));
+	resource->set_meta("aabb", aabb);
+	resource->set_meta("transform_2d", transform_2d);
+	resource->set_meta("basis", transform.basis);
+	resource->set_meta("transform", transform);
+	resource->set_meta("projection", projection);
+	resource->set_meta("vector3_array", PackedVector3Array({ Vector3(1, 2, 3), Vector3(-4, 5.5, 6) }));
+
+	uint32_t flags = 0;
+	SUBCASE("Byte order of the platform") {
+		flags = 0;
+	}
+	SUBCASE("Big endian") {
+		flags = ResourceSaver::FLAG_SAVE_BIG_ENDIAN;
+	}
+	const String save_path = TestUtils::get_temp_path("math_types.res");
+	REQUIRE(ResourceSaver::save(resource, save_path, flags) == OK);
+
+	const Ref<Resource> loaded = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded.is_valid());
+	CHECK(loaded->get_meta("vector2") == Variant(Vector2(1.25, -2.5)));
+	CHECK(loaded->get_meta("vector3") == Variant(Vector3(1, 2, 3)));
+	CHECK(loaded->get_meta("vector4") == Variant(Vector4(1, 2, 3, 4)));
+	CHECK(loaded->get_meta("rect2") == Variant(Rect2(1, 2, 3, 4)));
+	CHECK(loaded->get_meta("plane") == Variant(Plane(Vector3(0, 1, 0), 5)));
+	CHECK(loaded->get_meta("quaternion") == Variant(Quaternion(Vector3(1, 0, 0), 0.75)));
+	CHECK(loaded->get_meta("aabb") == Variant(aabb));
+	CHECK(loaded->get_meta("transform_2d") == Variant(transform_2d));
+	CHECK(loaded->get_meta("basis") == Variant(transform.basis));
+	CHECK(loaded->get_meta("transform") == Variant(transform));
+	CHECK(loaded->get_meta("projection") == Variant(projection));
+	CHECK(loaded->get_meta("vector3_array") == Variant(PackedVector3Array({ Vector3(1, 2, 3), Vector3(-4, 5.5, 6) })));
+}
+
 TEST_CASE("[Resource] Breaking circular references on save") {
 	Ref<Resource> resource_a = memnew(Resource);
 	resource_a->set_name("A");
@@ -166,6 +212,202 @@ TEST_CASE("[Resource] Breaking circular references on save") {
 	// Break circular reference to avoid memory leak
 	resource_c->remove_meta("next");
 }
+
+// Records what the resource loader asks for, leaving the actual loading to the built-in loaders.
+class ResourceFormatLoaderRecording : public ResourceFormatLoader {
+	GDCLASS(ResourceFormatLoaderRecording, ResourceFormatLoader);
+
+public:
+	String file_prefix;
+	Mutex mutex;
+	LocalVector<String> events;
+
+	virtual bool recognize_path(const String &p_path, const String &p_for_type = String()) const override {
+		return p_path.get_file().begins_with(file_prefix);
+	}
+
+	virtual void get_dependencies(const String &p_path, List<String> *p_dependencies, bool p_add_types = false) override {
+		MutexLock lock(mutex);
+		events.push_back("dependencies:" + p_path.get_file());
+	}
+
+	virtual Ref<Resource> load(const String &p_path, const String &p_original_path = "", Error *r_error = nullptr, bool p_use_sub_threads = false, float *r_progress = nullptr, CacheMode p_cache_mode = CACHE_MODE_REUSE) override {
+		MutexLock lock(mutex);
+		events.push_back("load:" + p_path.get_file());
+		return Ref<Resource>();
+	}
+};
+
+TEST_CASE("[Resource] Threaded loading with external dependencies") {
+	const String save_path_a = TestUtils::get_temp_path("threaded_resource_a.res");
+	const String save_path_b = TestUtils::get_temp_path("threaded_resource_b.res");
+	const String save_path_c = TestUtils::get_temp_path("threaded_resource_c.res");
+	{
+		Ref<Resource> resource_c = memnew(Resource);
+		resource_c->set_name("C");
+		resource_c->set_path(save_path_c);
+		ResourceSaver::save(resource_c, save_path_c);
+		Ref<Resource> resource_b = memnew(Resource);
+		resource_b->set_name("B");
+		resource_b->set_meta("next", resource_c);
+		resource_b->set_path(save_path_b);
+		ResourceSaver::save(resource_b, save_path_b);
+		Ref<Resource> resource_a = memnew(Resource);
+		resource_a->set_name("A");
+		resource_a->set_meta("next", resource_b);
+		ResourceSaver::save(resource_a, save_path_a);
+	}
+
+	Ref<ResourceFormatLoaderRecording> recording_loader;
+	recording_loader.instantiate();
+	recording_loader->file_prefix = "threaded_resource_";
+	ResourceLoader::add_resource_format_loader(recording_loader, true);
+
+	// The whole dependency tree is requested at once when sub-threads are used.
+	REQUIRE(ResourceLoader::load_threaded_request(save_path_a, "", true) == OK);
+	const Ref<Resource> loaded_resource_a = ResourceLoader::load_threaded_get(save_path_a);
+	ResourceLoader::remove_resource_format_loader(recording_loader);
+
+	// The dependencies of both A and B were read from their headers before A itself started loading,
+	// and the load of C started by that was shared with the one requested while parsing B.
+	const LocalVector<String> &events = recording_loader->events;
+	const int64_t load_a = events.find("load:threaded_resource_a.res");
+	REQUIRE(load_a >= 0);
+	const int64_t dependencies_a = events.find("dependencies:threaded_resource_a.res");
+	CHECK(dependencies_a >= 0);
+	CHECK(dependencies_a < load_a);
+	const int64_t dependencies_b = events.find("dependencies:threaded_resource_b.res");
+	CHECK(dependencies_b >= 0);
+	CHECK(dependencies_b < load_a);
+	int load_c_count = 0;
+	for (const String &event : events) {
+		if (event == "load:threaded_resource_c.res") {
+			load_c_count++;
+		}
+	}
+	CHECK(load_c_count == 1);
+
+	REQUIRE(loaded_resource_a.is_valid());
+	CHECK(loaded_resource_a->get_name() == "A");
+	const Ref<Resource> loaded_resource_b = loaded_resource_a->get_meta("next");
+	REQUIRE(loaded_resource_b.is_valid());
+	CHECK(loaded_resource_b->get_name() == "B");
+	CHECK(loaded_resource_b->get_path() == save_path_b);
+	const Ref<Resource> loaded_resource_c = loaded_resource_b->get_meta("next");
+	REQUIRE(loaded_resource_c.is_valid());
+	CHECK(loaded_resource_c->get_name() == "C");
+	CHECK(loaded_resource_c->get_path() == save_path_c);
+}
+
+TEST_CASE("[Resource] Loading a built-in resource on its own") {
+	const String save_path = TestUtils::get_temp_path("resource_with_built_ins.res");
+	{
+		Ref<Resource> resource = memnew(Resource);
+		Ref<Resource> first = memnew(Resource);
+		first->set_name("First");
+		first->set_scene_unique_id("first_id");
+		Ref<Resource> inner = memnew(Resource);
+		inner->set_name("Inner");
+		inner->set_scene_unique_id("inner_id");
+		first->set_meta("inner", inner);
+		Ref<Resource> second = memnew(Resource);
+		second->set_name("Second");
+		second->set_scene_unique_id("second_id");
+		resource->set_meta("first", first);
+		resource->set_meta("second", second);
+		ResourceSaver::save(resource, save_path);
+	}
+
+	const Ref<Resource> first = ResourceLoader::load(save_path + "::first_id");
+	REQUIRE(first.is_valid());
+	CHECK(first->get_name() == "First");
+	CHECK(first->get_path() == save_path + "::first_id");
+	const Ref<Resource> inner = first->get_meta("inner");
+	REQUIRE(inner.is_valid());
+	CHECK(inner->get_name() == "Inner");
+	CHECK_MESSAGE(
+			!ResourceCache::has(save_path + "::second_id"),
+			"Built-in resources not referenced by the requested one shouldn't be loaded.");
+	CHECK_MESSAGE(
+			!ResourceCache::has(save_path),
+			"The main resource shouldn't be loaded.");
+
+	const Ref<Resource> loaded_resource = ResourceLoader::load(save_path);
+	REQUIRE(loaded_resource.is_valid());
+	CHECK_MESSAGE(
+			Ref<Resource>(loaded_resource->get_meta("first")) == first,
+			"Loading the whole file should reuse the built-in resource already loaded.");
+	CHECK(Ref<Resource>(loaded_resource->get_meta("second"))->get_name() == "Second");
+
+	ERR_PRINT_OFF;
+	CHECK(ResourceLoader::load(save_path + "::missing_id").is_null());
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[Resource] Cancelling threaded loads") {
+	Vector<String> paths;
+	for (int i = 0; i < 32; i++) {
+		Ref<Resource> resource = memnew(Resource);
+		resource->set_name(itos(i));
+		paths.push_back(TestUtils::get_temp_path(vformat("cancelled_resource_%d.res", i)));
+		ResourceSaver::save(resource, paths[i]);
+	}
+
+	for (const String &path : paths) {
+		REQUIRE(ResourceLoader::load_threaded_request(path) == OK);
+	}
+	CHECK(ResourceLoader::load_threaded_prioritize(paths[paths.size() - 1]) == OK);
+	for (const String &path : paths) {
+		CHECK(ResourceLoader::load_threaded_cancel(path) == OK);
+	}
+
+	for (const String &path : paths) {
+		CHECK(ResourceLoader::load_threaded_get_status(path) == ResourceLoader::THREAD_LOAD_INVALID_RESOURCE);
+	}
+	CHECK(ResourceLoader::load_threaded_cancel(paths[0]) == ERR_INVALID_PARAMETER);
+	CHECK(ResourceLoader::load_threaded_prioritize(paths[0]) == ERR_INVALID_PARAMETER);
+
+	// Loading the same paths again waits for the cancelled loads that had already started.
+	// Once it's over, nothing else should be holding the resources.
+	for (const String &path : paths) {
+		CHECK(ResourceLoader::load(path).is_valid());
+	}
+	for (const String &path : paths) {
+		CHECK_MESSAGE(!ResourceCache::has(path), "Cancelled loads should not keep their resources alive.");
+	}
+
+	// Cancelled loads must not affect new requests for the same resources.
+	for (const String &path : paths) {
+		REQUIRE(ResourceLoader::load_threaded_request(path) == OK);
+	}
+	for (int i = 0; i < paths.size(); i++) {
+		Ref<Resource> resource = ResourceLoader::load_threaded_get(paths[i]);
+		REQUIRE(resource.is_valid());
+		CHECK(resource->get_name() == itos(i));
+	}
+}
+
+TEST_CASE("[Resource] Requesting threaded loads again while they are cancelled") {
+	Vector<String> paths;
+	for (int i = 0; i < 32; i++) {
+		Ref<Resource> resource = memnew(Resource);
+		resource->set_name(itos(i));
+		paths.push_back(TestUtils::get_temp_path(vformat("recancelled_resource_%d.res", i)));
+		ResourceSaver::save(resource, paths[i]);
+	}
+
+	// Some of the cancelled loads are still running when the same path is requested again.
+	for (const String &path : paths) {
+		REQUIRE(ResourceLoader::load_threaded_request(path) == OK);
+		CHECK(ResourceLoader::load_threaded_cancel(path) == OK);
+		REQUIRE(ResourceLoader::load_threaded_request(path) == OK);
+	}
+	for (int i = 0; i < paths.size(); i++) {
+		Ref<Resource> resource = ResourceLoader::load_threaded_get(paths[i]);
+		REQUIRE(resource.is_valid());
+		CHECK(resource->get_name() == itos(i));
+	}
+}
 } // namespace TestResource
 
 #endif // TEST_RESOURCE_H
@@ -464,6 +464,39 @@ TEST_CASE("[Object] Signals") {
 		object.get_all_signal_connections(&signal_connections);
 		CHECK(signal_connections.size() == 0);
 	}
+
+	SUBCASE("Emitting a signal connected to a bound method should call it") {
+		Object target;
+		object.connect("my_custom_signal", Callable(&target, "set_meta"));
+
+		Error err = object.emit_signal("my_custom_signal", "count", 1);
+		CHECK(err == OK);
+		CHECK(target.get_meta("count") == Variant(1));
+
+		err = object.emit_signal("my_custom_signal", "count", 2);
+		CHECK(err == OK);
+		CHECK(target.get_meta("count") == Variant(2));
+	}
+
+	SUBCASE("Changing connections between emissions should be taken into account") {
+		Object target;
+		object.connect("my_custom_signal", Callable(&target, "set_meta"), Object::CONNECT_ONE_SHOT);
+
+		object.emit_signal("my_custom_signal", "count", 1);
+		CHECK(target.get_meta("count") == Variant(1));
+		CHECK_FALSE(object.is_connected("my_custom_signal", Callable(&target, "set_meta")));
+
+		object.emit_signal("my_custom_signal", "count", 2);
+		CHECK(target.get_meta("count") == Variant(1));
+
+		object.connect("my_custom_signal", Callable(&target, "set_meta"));
+		object.emit_signal("my_custom_signal", "count", 3);
+		CHECK(target.get_meta("count") == Variant(3));
+
+		object.disconnect("my_custom_signal", Callable(&target, "set_meta"));
+		object.emit_signal("my_custom_signal", "count", 4);
+		CHECK(target.get_meta("count") == Variant(3));
+	}
 }
 
 class NotificationObject1 : public Object {
@@ -0,0 +1,131 @@
+/**************************************************************************/
+/*  test_editor_file_system.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#ifndef TEST_EDITOR_FILE_SYSTEM_H
+#define TEST_EDITOR_FILE_SYSTEM_H
+
+#include "core/io/config_file.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "editor/editor_file_system.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestEditorFileSystem {
+
+static void remove_dir(const String &p_dir) {
+	Ref<DirAccess> da = DirAccess::open(p_dir);
+	if (da.is_valid()) {
+		da->erase_contents_recursive();
+		DirAccess::remove_absolute(p_dir);
+	}
+}
+
+static void write_file(const String &p_path, const String &p_contents) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE);
+	REQUIRE(f.is_valid());
+	f->store_string(p_contents);
+}
+
+TEST_CASE("[EditorFileSystem] Import cache") {
+	const String cache_dir = TestUtils::get_temp_path("import_cache");
+	const String imported_dir = TestUtils::get_temp_path("import_cache_imported");
+	remove_dir(cache_dir);
+	remove_dir(imported_dir);
+	REQUIRE(DirAccess::make_dir_recursive_absolute(cache_dir) == OK);
+	REQUIRE(DirAccess::make_dir_recursive_absolute(imported_dir) == OK);
+
+	const String base_path = imported_dir.path_join("icon.png-0123456789abcdef");
+	const String entry_dir = cache_dir.path_join("ab").path_join("abcdef");
+	REQUIRE(DirAccess::make_dir_recursive_absolute(entry_dir.get_base_dir()) == OK);
+
+	List<String> variants;
+	Variant meta;
+
+	SUBCASE("Stored imports are copied back") {
+		write_file(base_path + ".s3tc.ctex", "s3tc");
+		write_file(base_path + ".etc2.ctex", "etc2");
+		List<String> stored_variants;
+		stored_variants.push_back("s3tc");
+		stored_variants.push_back("etc2");
+		Dictionary stored_meta;
+		stored_meta["imported_formats"] = "s3tc_bptc";
+		EditorFileSystem::_store_import_cache(entry_dir, base_path, { base_path + ".s3tc.ctex", base_path + ".etc2.ctex" }, stored_variants, stored_meta);
+		REQUIRE(DirAccess::dir_exists_absolute(entry_dir));
+
+		DirAccess::remove_absolute(base_path + ".s3tc.ctex");
+		DirAccess::remove_absolute(base_path + ".etc2.ctex");
+		CHECK(EditorFileSystem::_fetch_import_cache(entry_dir, base_path, &variants, &meta));
+		CHECK(FileAccess::get_file_as_string(base_path + ".s3tc.ctex") == "s3tc");
+		CHECK(FileAccess::get_file_as_string(base_path + ".etc2.ctex") == "etc2");
+		REQUIRE(variants.size() == 2);
+		CHECK(variants.front()->get() == "s3tc");
+		CHECK(variants.back()->get() == "etc2");
+		CHECK(meta == Variant(stored_meta));
+	}
+
+	SUBCASE("Missing entries are not found") {
+		CHECK_FALSE(EditorFileSystem::_fetch_import_cache(entry_dir, base_path, &variants, &meta));
+		CHECK(variants.is_empty());
+	}
+
+	SUBCASE("Entries writing outside of the imported folder are rejected") {
+		REQUIRE(DirAccess::make_dir_recursive_absolute(entry_dir) == OK);
+		write_file(entry_dir.path_join("data.ctex"), "valid");
+
+		Ref<ConfigFile> cf;
+		cf.instantiate();
+		cf->set_value("entry", "files", PackedStringArray({ ".ctex", "/../../escaped.ctex" }));
+		cf->set_value("entry", "variants", PackedStringArray());
+		REQUIRE(cf->save(entry_dir.path_join("entry.cfg")) == OK);
+
+		ERR_PRINT_OFF;
+		CHECK_FALSE(EditorFileSystem::_fetch_import_cache(entry_dir, base_path, &variants, &meta));
+		ERR_PRINT_ON;
+		CHECK_FALSE(FileAccess::exists(base_path + ".ctex"));
+		CHECK_FALSE(FileAccess::exists(imported_dir.get_base_dir().path_join("escaped.ctex")));
+
+		cf->set_value("entry", "files", PackedStringArray({ ".ctex" }));
+		cf->set_value("entry", "variants", PackedStringArray({ "s3tc/../../escaped" }));
+		REQUIRE(cf->save(entry_dir.path_join("entry.cfg")) == OK);
+		ERR_PRINT_OFF;
+		CHECK_FALSE(EditorFileSystem::_fetch_import_cache(entry_dir, base_path, &variants, &meta));
+		ERR_PRINT_ON;
+	}
+
+	remove_dir(cache_dir);
+	remove_dir(imported_dir);
+}
+
+} // namespace TestEditorFileSystem
+
+#endif // TEST_EDITOR_FILE_SYSTEM_H
@@ -430,6 +430,52 @@ TEST_CASE("[SceneTree][Node] Testing node operations with a more complex simple
 		CHECK_EQ(E->get(), node1_1);
 	}
 
+	SUBCASE("Groups should stay in tree order when nodes are added after sorting") {
+		Node *children[10];
+		for (int i = 0; i < 10; i++) {
+			children[i] = memnew(Node);
+			node2->add_child(children[i]);
+		}
+
+		for (int i : { 9, 7, 5, 3, 1 }) {
+			children[i]->add_to_group("sorted");
+		}
+
+		List<Node *> nodes;
+		SceneTree::get_singleton()->get_nodes_in_group("sorted", &nodes);
+		CHECK_EQ(nodes.size(), 5);
+
+		// Fewer new nodes than sorted ones, these are merged in.
+		for (int i : { 8, 0, 4 }) {
+			children[i]->add_to_group("sorted");
+		}
+
+		nodes.clear();
+		SceneTree::get_singleton()->get_nodes_in_group("sorted", &nodes);
+		CHECK_EQ(nodes.size(), 8);
+		int expected[8] = { 0, 1, 3, 4, 5, 7, 8, 9 };
+		int index = 0;
+		for (Node *node : nodes) {
+			CHECK_EQ(node, children[expected[index++]]);
+		}
+
+		children[3]->remove_from_group("sorted");
+		children[6]->add_to_group("sorted");
+		children[2]->add_to_group("sorted");
+		CHECK_EQ(SceneTree::get_singleton()->get_first_node_in_group("sorted"), children[0]);
+
+		nodes.clear();
+		SceneTree::get_singleton()->get_nodes_in_group("sorted", &nodes);
+		CHECK_EQ(nodes.size(), 9);
+		index = 0;
+		for (Node *node : nodes) {
+			if (index == 3) {
+				index++;
+			}
+			CHECK_EQ(node, children[index++]);
+		}
+	}
+
 	SUBCASE("Nodes added as siblings of another node should be right next to it") {
 		node1->remove_child(node1_1);
 
@@ -474,6 +520,64 @@ TEST_CASE("[SceneTree][Node] Testing node operations with a more complex simple
 		CHECK_EQ(E->get(), node2);
 	}
 
+	SUBCASE("Nodes should be found by path after the tree changes") {
+		Node *root = SceneTree::get_singleton()->get_root();
+		node1->set_name("Node1");
+		node2->set_name("Node2");
+		node1_1->set_name("NestedNode");
+
+		CHECK_EQ(root->get_node_or_null(NodePath("Node1/NestedNode")), node1_1);
+		CHECK_EQ(root->get_node_or_null(NodePath("Node1/NestedNode")), node1_1);
+		CHECK_EQ(node1_1->get_node_or_null(NodePath("../../Node2")), node2);
+
+		node1_1->set_name("Renamed");
+		CHECK_EQ(root->get_node_or_null(NodePath("Node1/NestedNode")), nullptr);
+		CHECK_EQ(root->get_node_or_null(NodePath("Node1/Renamed")), node1_1);
+
+		node1->remove_child(node1_1);
+		node2->add_child(node1_1);
+		CHECK_EQ(root->get_node_or_null(NodePath("Node1/Renamed")), nullptr);
+		CHECK_EQ(root->get_node_or_null(NodePath("Node2/Renamed")), node1_1);
+		CHECK_EQ(node1_1->get_node_or_null(NodePath("../../Node2")), node2);
+
+		Node *node1_2 = memnew(Node);
+		node1_2->set_name("Renamed");
+		node1->add_child(node1_2);
+		CHECK_EQ(root->get_node_or_null(NodePath("Node1/Renamed")), node1_2);
+
+		node1->set_name("Other");
+		CHECK_EQ(root->get_node_or_null(NodePath("Node1/Renamed")), nullptr);
+		CHECK_EQ(root->get_node_or_null(NodePath("Other/Renamed")), node1_2);
+
+		memdelete(node1_2);
+		CHECK_EQ(root->get_node_or_null(NodePath("Other/Renamed")), nullptr);
+
+		// Freeing a node in the middle of a cached path.
+		Node *middle = memnew(Node);
+		middle->set_name("Middle");
+		Node *leaf = memnew(Node);
+		leaf->set_name("Leaf");
+		middle->add_child(leaf);
+		node1->add_child(middle);
+		CHECK_EQ(root->get_node_or_null(NodePath("Other/Middle/Leaf")), leaf);
+		memdelete(middle);
+		CHECK_EQ(root->get_node_or_null(NodePath("Other/Middle/Leaf")), nullptr);
+
+		// Unique names found through the owner.
+		Node *unique = memnew(Node);
+		unique->set_name("Unique");
+		node1->add_child(unique);
+		unique->set_owner(node1);
+		unique->set_unique_name_in_owner(true);
+		CHECK_EQ(root->get_node_or_null(NodePath("Other/%Unique")), unique);
+		unique->set_unique_name_in_owner(false);
+		CHECK_EQ(root->get_node_or_null(NodePath("Other/%Unique")), nullptr);
+		unique->set_unique_name_in_owner(true);
+		CHECK_EQ(root->get_node_or_null(NodePath("Other/%Unique")), unique);
+		memdelete(unique);
+		CHECK_EQ(root->get_node_or_null(NodePath("Other/%Unique")), nullptr);
+	}
+
 	SUBCASE("Duplicating a node should also duplicate the children") {
 		node1->set_name("MyName1");
 		node1_1->set_name("MyName1_1");
@@ -499,6 +603,195 @@ TEST_CASE("[SceneTree][Node] Testing node operations with a more complex simple
 	memdelete(node2);
 }
 
+TEST_CASE("[SceneTree][Node] Adding and removing children in batches") {
+	Node *parent = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	TypedArray<Node> children;
+	for (int i = 0; i < 4; i++) {
+		TestNode *child = memnew(TestNode);
+		child->set_name(vformat("Child%d", i));
+		child->add_to_group("batched");
+		child->set_process(true);
+		children.push_back(child);
+	}
+
+	parent->add_children(children);
+
+	CHECK_EQ(parent->get_child_count(), 4);
+	CHECK_EQ(SceneTree::get_singleton()->get_node_count_in_group("batched"), 4);
+	for (int i = 0; i < 4; i++) {
+		Node *child = Object::cast_to<Node>(children[i]);
+		CHECK(child->is_inside_tree());
+		CHECK(child->is_ready());
+		CHECK_EQ(parent->get_child(i), child);
+	}
+
+	SUBCASE("Removed children should leave their groups and stop processing") {
+		TypedArray<Node> removed;
+		removed.push_back(children[1]);
+		removed.push_back(children[3]);
+		removed.push_back(children[1]); // Listed twice.
+
+		parent->remove_children(removed);
+
+		CHECK_EQ(parent->get_child_count(), 2);
+		CHECK_EQ(parent->get_child(0), Object::cast_to<Node>(children[0]));
+		CHECK_EQ(parent->get_child(1), Object::cast_to<Node>(children[2]));
+
+		List<Node *> nodes;
+		SceneTree::get_singleton()->get_nodes_in_group("batched", &nodes);
+		CHECK_EQ(nodes.size(), 2);
+		CHECK_EQ(nodes.front()->get(), Object::cast_to<Node>(children[0]));
+		CHECK_EQ(nodes.back()->get(), Object::cast_to<Node>(children[2]));
+
+		SceneTree::get_singleton()->process(0);
+		for (int i = 0; i < 4; i++) {
+			TestNode *child = Object::cast_to<TestNode>(children[i]);
+			CHECK_EQ(child->is_inside_tree(), !(i == 1 || i == 3));
+			CHECK_EQ(child->process_counter, (i == 1 || i == 3) ? 0 : 1);
+		}
+
+		// Adding them back should register them again, and reject the duplicate since it already has a parent.
+		ERR_PRINT_OFF;
+		parent->add_children(removed);
+		ERR_PRINT_ON;
+		CHECK_EQ(parent->get_child_count(), 4);
+		CHECK_EQ(Object::cast_to<Node>(children[1])->get_parent(), parent);
+		CHECK_EQ(SceneTree::get_singleton()->get_node_count_in_group("batched"), 4);
+	}
+
+	SUBCASE("Removing all children should remove the group") {
+		parent->remove_children(children);
+
+		CHECK_EQ(parent->get_child_count(), 0);
+		CHECK_FALSE(SceneTree::get_singleton()->has_group("batched"));
+
+		for (int i = 0; i < 4; i++) {
+			Node *child = Object::cast_to<Node>(children[i]);
+			CHECK_FALSE(child->is_inside_tree());
+			CHECK_EQ(child->get_parent(), nullptr);
+		}
+	}
+
+	for (int i = 0; i < children.size(); i++) {
+		memdelete(Object::cast_to<Node>(children[i]));
+	}
+	memdelete(parent);
+}
+
+TEST_CASE("[Node] Child indices should stay valid when adding and removing children") {
+	Node *parent = memnew(Node);
+	Node *front = memnew(Node);
+	Node *back = memnew(Node);
+	parent->add_child(front, false, Node::INTERNAL_MODE_FRONT);
+	parent->add_child(back, false, Node::INTERNAL_MODE_BACK);
+
+	Node *children[5];
+	for (int i = 0; i < 5; i++) {
+		children[i] = memnew(Node);
+		parent->add_child(children[i]);
+	}
+
+	CHECK_EQ(parent->get_child_count(), 5);
+	CHECK_EQ(parent->get_child_count(true), 7);
+	CHECK_EQ(parent->get_child(0, true), front);
+	CHECK_EQ(parent->get_child(6, true), back);
+	for (int i = 0; i < 5; i++) {
+		CHECK_EQ(children[i]->get_index(false), i);
+		CHECK_EQ(parent->get_child(i), children[i]);
+	}
+
+	Node *front2 = memnew(Node);
+	parent->add_child(front2, false, Node::INTERNAL_MODE_FRONT);
+	CHECK_EQ(parent->get_child(1, true), front2);
+	CHECK_EQ(children[0]->get_index(true), 2);
+	CHECK_EQ(back->get_index(true), 7);
+
+	parent->remove_child(children[1]);
+	CHECK_EQ(parent->get_child_count(), 4);
+	CHECK_EQ(children[2]->get_index(false), 1);
+	CHECK_EQ(children[4]->get_index(false), 3);
+	CHECK_EQ(parent->get_child(1), children[2]);
+	CHECK_EQ(back->get_index(), 6);
+
+	parent->remove_child(front);
+	CHECK_EQ(front2->get_index(true), 0);
+	CHECK_EQ(children[0]->get_index(true), 1);
+	CHECK_EQ(parent->get_child(0, true), front2);
+
+	TypedArray<Node> to_remove;
+	to_remove.push_back(children[0]);
+	to_remove.push_back(children[3]);
+	parent->remove_children(to_remove);
+	CHECK_EQ(parent->get_child_count(), 2);
+	CHECK_EQ(parent->get_child(0), children[2]);
+	CHECK_EQ(parent->get_child(1), children[4]);
+	CHECK_EQ(children[4]->get_index(false), 1);
+	CHECK_EQ(back->get_index(true), 3);
+
+	Node *child = memnew(Node);
+	parent->add_child(child);
+	CHECK_EQ(child->get_index(false), 2);
+	CHECK_EQ(parent->get_child(2), child);
+	CHECK_EQ(parent->get_child(-1, true), back);
+
+	memdelete(front);
+	memdelete(children[0]);
+	memdelete(children[1]);
+	memdelete(children[3]);
+	memdelete(parent);
+}
+
+TEST_CASE("[SceneTree][Node] Processing independent children") {
+	Node *parent = memnew(Node);
+	parent->set_process_thread_independent_children(true);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	TestNode *child1 = memnew(TestNode);
+	TestNode *child2 = memnew(TestNode);
+	TestNode *grandchild = memnew(TestNode);
+	child1->add_child(grandchild);
+	parent->add_child(child1);
+	parent->add_child(child2);
+
+	child1->set_process(true);
+	child2->set_physics_process(true);
+	grandchild->set_process(true);
+
+	SceneTree::get_singleton()->process(0);
+	SceneTree::get_singleton()->physics_process(0);
+
+	CHECK_EQ(child1->process_counter, 1);
+	CHECK_EQ(child2->physics_process_counter, 1);
+	CHECK_EQ(grandchild->process_counter, 1);
+
+	SUBCASE("Disabling independent children should keep processing the nodes once") {
+		parent->set_process_thread_independent_children(false);
+		SceneTree::get_singleton()->process(0);
+		SceneTree::get_singleton()->physics_process(0);
+
+		CHECK_EQ(child1->process_counter, 2);
+		CHECK_EQ(child2->physics_process_counter, 2);
+		CHECK_EQ(grandchild->process_counter, 2);
+	}
+
+	SUBCASE("Children with their own thread group should not be affected") {
+		child2->set_process_thread_group(Node::PROCESS_THREAD_GROUP_MAIN_THREAD);
+		child1->set_process_thread_group(Node::PROCESS_THREAD_GROUP_INHERIT);
+		parent->set_process_thread_independent_children(false);
+		parent->set_process_thread_independent_children(true);
+		SceneTree::get_singleton()->process(0);
+		SceneTree::get_singleton()->physics_process(0);
+
+		CHECK_EQ(child1->process_counter, 2);
+		CHECK_EQ(child2->physics_process_counter, 2);
+		CHECK_EQ(grandchild->process_counter, 2);
+	}
+
+	memdelete(parent);
+}
+
 TEST_CASE("[SceneTree][Node]Exported node checks") {
 	TestNode *node = memnew(TestNode);
 	SceneTree::get_singleton()->get_root()->add_child(node);
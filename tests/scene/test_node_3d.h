@@ -0,0 +1,210 @@
+/**************************************************************************/
+/*  test_node_3d.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#ifndef TEST_NODE_3D_H
+#define TEST_NODE_3D_H
+
+#include "scene/3d/mesh_instance_3d.h"
+#include "scene/3d/node_3d.h"
+#include "scene/main/window.h"
+#include "scene/resources/3d/primitive_meshes.h"
+#include "scene/resources/3d/world_3d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNode3D {
+
+class TestNotifyNode3D : public Node3D {
+	GDCLASS(TestNotifyNode3D, Node3D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
+			transform_changed_count++;
+		}
+	}
+
+public:
+	int transform_changed_count = 0;
+
+	TestNotifyNode3D() {
+		set_notify_transform(true);
+	}
+};
+
+TEST_CASE("[SceneTree][Node3D] Transform changes reach deep descendants") {
+	Node3D *root = memnew(Node3D);
+	Node3D *parent = root;
+	for (int i = 0; i < 16; i++) {
+		Node3D *child = memnew(Node3D);
+		child->set_position(Vector3(1, 0, 0));
+		parent->add_child(child);
+		parent = child;
+	}
+	TestNotifyNode3D *leaf = memnew(TestNotifyNode3D);
+	parent->add_child(leaf);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+	SceneTree::get_singleton()->flush_transform_notifications();
+	CHECK(leaf->get_global_position().is_equal_approx(Vector3(16, 0, 0)));
+
+	SUBCASE("Several changes within one pass notify once") {
+		leaf->transform_changed_count = 0;
+		root->set_position(Vector3(0, 1, 0));
+		root->set_position(Vector3(0, 2, 0));
+		root->set_position(Vector3(0, 3, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK_EQ(leaf->transform_changed_count, 1);
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(16, 3, 0)));
+	}
+
+	SUBCASE("Each pass notifies again") {
+		leaf->transform_changed_count = 0;
+		root->set_position(Vector3(0, 1, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK_EQ(leaf->transform_changed_count, 1);
+
+		// The descendants are still dirty from the first pass, as nobody read their global transform.
+		root->set_position(Vector3(0, 2, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK_EQ(leaf->transform_changed_count, 2);
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(16, 2, 0)));
+	}
+
+	memdelete(root);
+}
+
+TEST_CASE("[SceneTree][Node3D] Child with notify_transform is notified of parent changes") {
+	Node3D *parent = memnew(Node3D);
+	TestNotifyNode3D *child = memnew(TestNotifyNode3D);
+	child->set_position(Vector3(0, 0, 1));
+	parent->add_child(child);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+	SceneTree::get_singleton()->flush_transform_notifications();
+
+	child->transform_changed_count = 0;
+	parent->set_position(Vector3(1, 0, 0));
+	SceneTree::get_singleton()->flush_transform_notifications();
+	CHECK_EQ(child->transform_changed_count, 1);
+	CHECK(child->get_global_position().is_equal_approx(Vector3(1, 0, 1)));
+
+	// No change, no notification.
+	SceneTree::get_singleton()->flush_transform_notifications();
+	CHECK_EQ(child->transform_changed_count, 1);
+
+	child->set_notify_transform(false);
+	parent->set_position(Vector3(2, 0, 0));
+	SceneTree::get_singleton()->flush_transform_notifications();
+	CHECK_EQ(child->transform_changed_count, 1);
+
+	memdelete(parent);
+}
+
+TEST_CASE("[SceneTree][Node3D] Nodes entering under an already invalidated parent are notified") {
+	Node3D *root = memnew(Node3D);
+	Node3D *parent = memnew(Node3D);
+	Node3D *other = memnew(Node3D);
+	root->add_child(parent);
+	root->add_child(other);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+	SceneTree::get_singleton()->flush_transform_notifications();
+
+	TestNotifyNode3D *child = memnew(TestNotifyNode3D);
+
+	SUBCASE("Added as a new child") {
+		// Leaves the parent invalidated and marked as visited for the current pass.
+		parent->set_position(Vector3(1, 0, 0));
+		parent->add_child(child);
+	}
+
+	SUBCASE("Reparented from another node") {
+		other->add_child(child);
+		SceneTree::get_singleton()->flush_transform_notifications();
+		parent->set_position(Vector3(1, 0, 0));
+		child->reparent(parent, false);
+	}
+
+	CHECK_EQ(child->get_parent(), parent);
+	child->transform_changed_count = 0;
+	root->set_position(Vector3(0, 1, 0));
+	SceneTree::get_singleton()->flush_transform_notifications();
+	CHECK_EQ(child->transform_changed_count, 1);
+	CHECK(child->get_global_position().is_equal_approx(Vector3(1, 1, 0)));
+
+	memdelete(root);
+}
+
+TEST_CASE("[SceneTree][Node3D] Instance transforms are sent to the RenderingServer once the notifications are flushed") {
+	Ref<BoxMesh> mesh;
+	mesh.instantiate();
+	const RID scenario = SceneTree::get_singleton()->get_root()->get_world_3d()->get_scenario();
+
+	Node3D *root = memnew(Node3D);
+	LocalVector<MeshInstance3D *> mesh_instances;
+	for (int i = 0; i < 8; i++) {
+		MeshInstance3D *mesh_instance = memnew(MeshInstance3D);
+		mesh_instance->set_mesh(mesh);
+		mesh_instance->set_custom_aabb(AABB(Vector3(-0.5, -0.5, -0.5), Vector3(1, 1, 1)));
+		root->add_child(mesh_instance);
+		mesh_instances.push_back(mesh_instance);
+	}
+	SceneTree::get_singleton()->get_root()->add_child(root);
+	SceneTree::get_singleton()->flush_transform_notifications();
+
+	const int count = mesh_instances.size();
+	for (int i = 0; i < count; i++) {
+		mesh_instances[i]->set_position(Vector3(i * 10, 100, 0));
+	}
+
+	// The new transforms are still waiting for the notifications.
+	const AABB moved_area(Vector3(-1, 99, -1), Vector3(count * 10, 2, 2));
+	CHECK(RS::get_singleton()->instances_cull_aabb(moved_area, scenario).is_empty());
+
+	// All of them reach the server in a single batch.
+	SceneTree::get_singleton()->flush_transform_notifications();
+	for (int i = 0; i < count; i++) {
+		const Vector<ObjectID> culled = RS::get_singleton()->instances_cull_aabb(AABB(Vector3(i * 10 - 1, 99, -1), Vector3(2, 2, 2)), scenario);
+		CHECK_EQ(culled.size(), 1);
+		CHECK(culled.has(mesh_instances[i]->get_instance_id()));
+	}
+
+	// A node leaving the tree right after moving doesn't leave a stale entry behind.
+	mesh_instances[0]->set_position(Vector3(0, 200, 0));
+	root->remove_child(mesh_instances[0]);
+	SceneTree::get_singleton()->flush_transform_notifications();
+	CHECK(RS::get_singleton()->instances_cull_aabb(AABB(Vector3(-1, 199, -1), Vector3(2, 2, 2)), scenario).is_empty());
+
+	memdelete(mesh_instances[0]);
+	memdelete(root);
+}
+
+} // namespace TestNode3D
+
+#endif // TEST_NODE_3D_H
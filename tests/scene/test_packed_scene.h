@@ -216,6 +216,51 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+TEST_CASE("[PackedScene] Instantiate Many") {
+	// Create a scene to pack.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+	scene->set_process_priority(5);
+
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	child->set_physics_process_priority(3);
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	// Pack the scene.
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+
+	// Instantiate the packed scene several times.
+	TypedArray<Node> instances = packed_scene.instantiate_many(3);
+	CHECK(instances.size() == 3);
+
+	for (int i = 0; i < instances.size(); i++) {
+		Node *instance = Object::cast_to<Node>(instances[i]);
+		REQUIRE(instance != nullptr);
+		CHECK(instance->get_name() == "TestScene");
+		CHECK(instance->get_process_priority() == 5);
+		REQUIRE(instance->get_child_count() == 1);
+		CHECK(instance->get_child(0)->get_name() == "Child");
+		CHECK(instance->get_child(0)->get_physics_process_priority() == 3);
+		CHECK(instance->get_child(0)->get_owner() == instance);
+		memdelete(instance);
+	}
+
+	// Changing the state must not reuse stale setters.
+	scene->set_process_priority(7);
+	packed_scene.pack(scene);
+	Node *instance = packed_scene.instantiate();
+	REQUIRE(instance != nullptr);
+	CHECK(instance->get_process_priority() == 7);
+
+	CHECK(packed_scene.instantiate_many(0).is_empty());
+
+	memdelete(instance);
+	memdelete(scene);
+}
+
 TEST_CASE("[PackedScene] Set Path") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);
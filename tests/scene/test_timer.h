@@ -212,6 +212,55 @@ TEST_CASE("[SceneTree][Timer] Check Timer timeout signal") {
 	memdelete(test_timer);
 }
 
+class TestTimerSubclass : public Timer {
+	GDCLASS(TestTimerSubclass, Timer);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_INTERNAL_PROCESS) {
+			internal_process_count++;
+		}
+	}
+
+public:
+	int internal_process_count = 0;
+};
+
+TEST_CASE("[SceneTree][Timer] Check Timer direct process callback") {
+	// Plain timers get their process notifications through a direct callback, subclasses through notification().
+	Timer *test_timer = memnew(Timer);
+	TestTimerSubclass *subclass_timer = memnew(TestTimerSubclass);
+	SceneTree::get_singleton()->get_root()->add_child(test_timer);
+	SceneTree::get_singleton()->get_root()->add_child(subclass_timer);
+
+	test_timer->set_one_shot(true);
+	subclass_timer->set_one_shot(true);
+	test_timer->start(0.1);
+	subclass_timer->start(0.1);
+
+	SIGNAL_WATCH(test_timer, SNAME("timeout"));
+
+	SceneTree::get_singleton()->process(0.05);
+	CHECK_FALSE(test_timer->is_stopped());
+	CHECK(test_timer->get_time_left() == doctest::Approx(0.05));
+	SIGNAL_CHECK_FALSE(SNAME("timeout"));
+
+	SceneTree::get_singleton()->process(0.1);
+
+	Array signal_args;
+	signal_args.push_back(Array());
+	SIGNAL_CHECK(SNAME("timeout"), signal_args);
+	CHECK(test_timer->is_stopped());
+
+	CHECK(subclass_timer->internal_process_count == 2);
+	CHECK(subclass_timer->is_stopped());
+
+	SIGNAL_UNWATCH(test_timer, SNAME("timeout"));
+
+	memdelete(subclass_timer);
+	memdelete(test_timer);
+}
+
 } // namespace TestTimer
 
 #endif // TEST_TIMER_H
@@ -111,6 +111,11 @@
 #include "tests/core/variant/test_dictionary.h"
 #include "tests/core/variant/test_variant.h"
 #include "tests/core/variant/test_variant_utility.h"
+
+#ifdef TOOLS_ENABLED
+#include "tests/editor/test_editor_file_system.h"
+#endif // TOOLS_ENABLED
+
 #include "tests/scene/test_animation.h"
 #include "tests/scene/test_audio_stream_wav.h"
 #include "tests/scene/test_bit_map.h"
@@ -173,6 +178,7 @@
 #include "tests/scene/test_camera_3d.h"
 #include "tests/scene/test_gltf_document.h"
 #include "tests/scene/test_height_map_shape_3d.h"
+#include "tests/scene/test_node_3d.h"
 #include "tests/scene/test_path_3d.h"
 #include "tests/scene/test_path_follow_3d.h"
 #include "tests/scene/test_primitives.h"